@@ -4,11 +4,35 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
-typedef struct Array Array;  //For data-hiding.
-
+#ifndef INITIAL_SIZE
 #define INITIAL_SIZE	(4)  //user can define the initial size.
+#endif
+#ifndef MAX_SIZE
 #define MAX_SIZE (4096)  //user can define the max size of the array.
+#endif
+#define INLINE_SIZE (4)  // fixed, so every translation unit agrees on sizeof(Array).
+#ifndef SORT_THREADS
+#define SORT_THREADS (4)  //user can define the number of threads arraySort() uses.
+#endif
+
+// The struct is exposed only so that an Array can live on the stack or inside
+// another struct. Use the functions below instead of touching its members.
+// The first INLINE_SIZE pointers (or as many values as fit in the same bytes)
+// are kept in inlineBuffer. contents stays NULL until they spill to the heap,
+// so a small Array needs no allocation and may be moved with memcpy.
+typedef struct Array {
+	void *contents;
+	size_t elemSize;
+	int byValue;
+	int size;
+	int count;
+	union {
+		void *pointers[INLINE_SIZE];
+		long double alignment;
+	}inlineBuffer;
+}Array;
 
 Array *arrayCreate();
 void arrayDestroy(Array *array);
@@ -19,6 +43,57 @@ int arrayInsert(Array *array, int index, void *newData);
 int arrayCount(const Array * array);
 void *arrayGet(const Array *array, int index);
 void *arrayRemove(Array *array, int index);
+
+// An array created by arrayCreateSized() stores each element by value in
+// one contiguous buffer. arrayGet() returns the address of the element.
+Array *arrayCreateSized(size_t elemSize);
+int arrayAddValue(Array *array, const void *value);
+int arrayGetValue(const Array *array, int index, void *outValue);
+int arraySetValue(Array *array, int index, const void *value);
+int arrayInsertValue(Array *array, int index, const void *value);
+int arrayRemoveValue(Array *array, int index, void *outValue);
+
+// arrayInit() and arrayInitSized() prepare an Array the caller owns.
+// arrayRelease() frees its heap storage but not the Array itself.
+int arrayInit(Array *array);
+int arrayInitSized(Array *array, size_t elemSize);
+void arrayRelease(Array *array);
+
+// Range functions move the tail once and check the capacity once.
+// elements points to n consecutive elements, e.g. a void *[] for a pointer array.
+// arrayReserve() doubles the capacity until it is at least capacity;
+// arrayCapacity() returns how many elements fit before the next allocation.
+int arrayReserve(Array *array, int capacity);
+int arrayCapacity(const Array *array);
+int arrayAddRange(Array *array, const void *elements, int n);
+int arrayInsertRange(Array *array, int index, const void *elements, int n);
+int arrayRemoveRange(Array *array, int index, int n, void *outElements);
+
+// Removing shrinks the buffer by half when it is less than a quarter full.
+// arrayShrinkToFit() releases all unused capacity at once.
+int arrayShrinkToFit(Array *array);
+
+// compare receives what arrayGet() returns : the stored pointer, or the
+// address of the element for an array created by arrayCreateSized().
+// The search functions call compare(key, element).
+typedef int (*CompareFunction)(const void *data1, const void *data2);
+
+int arraySort(Array *array, CompareFunction compare);
+int arrayBinarySearch(const Array *array, const void *key, CompareFunction compare);
+int arrayLowerBound(const Array *array, const void *key, CompareFunction compare);
+Array *arrayMergeSorted(const Array *array1, const Array *array2, CompareFunction compare);
+
+// Linear scans that compare several elements per instruction (SSE2 or AVX2,
+// chosen once at run time). They return the first matching index or -1.
+// arrayIndexOf() compares the stored pointers of a pointer array.
+// The others need an array created by arrayCreateSized(sizeof(int32_t)) or
+// arrayCreateSized(sizeof(int64_t)). arrayCountIf() and arrayFilterInto() select
+// the int32_t values in [low, high]; arrayFilterInto() appends them to out.
+int arrayIndexOf(const Array *array, const void *data);
+int arrayFindInt32(const Array *array, int32_t value);
+int arrayFindInt64(const Array *array, int64_t value);
+int arrayCountIf(const Array *array, int32_t low, int32_t high);
+int arrayFilterInto(const Array *array, int32_t low, int32_t high, Array *out);
 	
 // 迭 
 // (1)  .
@@ -1,30 +1,137 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <threads.h>
 #include "Array.h"
 
-typedef struct Array {
-	void **contents;
-	int size;
-	int count;
-}Array;
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_SSE2
+#define TARGET_AVX2
+#else
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// The heap buffer after the first spill, the inline buffer before it.
+static char *storage(const Array *array) {
+	return (array->contents != NULL) ? array->contents : (char *)array->inlineBuffer.pointers;
+}
+
+static char *slotAt(const Array *array, int index) {
+	return storage(array) + (size_t)index * array->elemSize;
+}
+
+int arrayInitSized(Array *array, size_t elemSize) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayInitSized : argument is null.\n");
+		return -1;
+	}
+
+	if (elemSize == 0) {
+		fprintf(stderr, "arrayInitSized : invalid element size.\n");
+		return -1;
+	}
+
+	array->contents = NULL;
+	array->elemSize = elemSize;
+	array->byValue = 1;
+	array->size = (int)(sizeof(array->inlineBuffer) / elemSize);
+	array->count = 0;
+	return 0;
+}
+
+int arrayInit(Array *array) {
+	if (arrayInitSized(array, sizeof(void *)) == -1)
+		return -1;
+	array->byValue = 0;
+	return 0;
+}
+
+void arrayRelease(Array *array) {
+	if (array == NULL)
+		return;
+	free(array->contents);
+	array->contents = NULL;
+	array->size = (int)(sizeof(array->inlineBuffer) / array->elemSize);
+	array->count = 0;
+}
 
 Array *arrayCreate() {
-	Array *array = calloc(1, sizeof(Array));
+	Array *array = malloc(sizeof(Array));
 	if (array == NULL) {
 		perror("arrayCreate");
 		return NULL;
 	}
+	arrayInit(array);
+	return array;
+}
+
+Array *arrayCreateSized(size_t elemSize) {
+	if (elemSize == 0) {
+		fprintf(stderr, "arrayCreateSized : invalid element size.\n");
+		return NULL;
+	}
+
+	Array *array = malloc(sizeof(Array));
+	if (array == NULL) {
+		perror("arrayCreateSized");
+		return NULL;
+	}
+	arrayInitSized(array, elemSize);
 	return array;
 }
 
 void arrayDestroy(Array *array) {
 	if (array == NULL)
 		return;
-	free(array->contents);
+	arrayRelease(array);
 	free(array);
 }
 
+static int inlineSize(const Array *array) {
+	return (int)(sizeof(array->inlineBuffer) / array->elemSize);
+}
+
+// Moves the elements to a buffer of newSize elements, the inline one if they fit.
+static int resizeStorage(Array *array, int newSize) {
+	if (newSize <= inlineSize(array)) {
+		if (array->contents != NULL) {
+			memcpy(array->inlineBuffer.pointers, array->contents, (size_t)array->count * array->elemSize);
+			free(array->contents);
+			array->contents = NULL;
+		}
+		array->size = inlineSize(array);
+		return 0;
+	}
+
+	void *newContents = NULL;
+	if (array->contents == NULL) {
+		// First spill : the elements leave the inline buffer.
+		newContents = calloc(newSize, array->elemSize);
+		if (newContents == NULL) {
+			perror("resizeStorage");
+			return -1;
+		}
+		memcpy(newContents, array->inlineBuffer.pointers, (size_t)array->count * array->elemSize);
+	}
+	else {
+		newContents = realloc(array->contents, array->elemSize * newSize);
+		if (newContents == NULL) {
+			fprintf(stderr, "resizeStorage : realloc failed.\n");
+			return -1;
+		}
+	}
+
+	array->contents = newContents;
+	array->size = newSize;
+	return 0;
+}
+
 static int increaseSize(Array *array, int size) {
 	if (array == NULL) {
 		fprintf(stderr, "increaseSize : argument is null.\n");
@@ -36,36 +143,60 @@ static int increaseSize(Array *array, int size) {
 		return -1;
 	}
 
-	if (size < array->size) {
+	if (size <= array->size) {
 		return 0;
 	}
 
+	if (size > MAX_SIZE) {
+		fprintf(stderr, "increaseSize : size overflow.\n");
+		return -1;
+	}
+
 	int newSize = (array->size == 0) ? INITIAL_SIZE : array->size;
 	while (newSize < size) {
-		newSize *= 2;
-		if (newSize > MAX_SIZE || newSize < size) {
-			newSize = MAX_SIZE;
-		}
+		newSize = (newSize > MAX_SIZE / 2) ? MAX_SIZE : newSize * 2;
 	}
 
-	void **newContents = NULL;
-	if (array->contents == NULL) { 
-		newContents = calloc(newSize, sizeof(void *));
-		if (newContents == NULL) {
-			perror("increaseSize");
-			return -1;
-		}
+	return resizeStorage(array, newSize);
+}
+
+// Halves the buffer once it is less than a quarter full. Growing happens only
+// when it is full, so adds and removes around one size can't resize every time.
+static void decreaseSize(Array *array) {
+	if (array->contents == NULL || array->count >= array->size / 4)
+		return;
+
+	int newSize = array->size / 2;
+	if (newSize < INITIAL_SIZE)
+		newSize = INITIAL_SIZE;
+	if (newSize < array->size)
+		resizeStorage(array, newSize);  // the old buffer is kept if this fails.
+}
+
+int arrayShrinkToFit(Array *array) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayShrinkToFit: argument is null\n");
+		return -1;
 	}
-	else {
-		newContents = realloc(array->contents, sizeof(void *) * newSize);
-		if (newContents == NULL) {
-			fprintf(stderr, "increaseSize : realloc failed.\n");
-			return -1;
-		}
+
+	if (array->contents == NULL || array->count == array->size)
+		return 0;
+	return resizeStorage(array, array->count);
+}
+
+int arrayAddValue(Array *array, const void *value) {
+	if (array == NULL || value == NULL) {
+		fprintf(stderr, "arrayAddValue: argument is null\n");
+		return -1;
 	}
 
-	array->contents = newContents;
-	array->size = newSize;
+	if (increaseSize(array, array->count + 1) == -1) {
+		fprintf(stderr, "arrayAddValue : memory allocation failed\n");
+		return -1;
+	}
+
+	memcpy(slotAt(array, array->count), value, array->elemSize);
+	++(array->count);
 	return 0;
 }
 
@@ -75,14 +206,11 @@ int arrayAdd(Array *array, void *data) {
 		return -1;
 	}
 
-	if (increaseSize(array, array->count + 1) == -1) {
-		fprintf(stderr, "arrayAdd : memory allocation failed\n");
+	if (array->byValue) {
+		fprintf(stderr, "arrayAdd: array stores values, use arrayAddValue\n");
 		return -1;
 	}
-
-	array->contents[array->count] = data;
-	++(array->count);
-	return 0;
+	return arrayAddValue(array, &data);
 }
 
 void arrayDisplay(const Array *array, const char *(*display)(const void *)) {
@@ -95,53 +223,87 @@ void arrayDisplay(const Array *array, const char *(*display)(const void *)) {
 	system("cls");
 	for (int i = 0; i < array->size; i++) {
 		if (i < array->count)
-			printf("[%s]", display(array->contents[i]));
+			printf("[%s]", display(arrayGet(array, i)));
 		else
 			printf("[%2c]", ' ');
 	}
 	getchar();
 }
 
+int arraySetValue(Array *array, int index, const void *value) {
+	if (array == NULL || value == NULL) {
+		fprintf(stderr, "arraySetValue: argument is null\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= array->count) {
+		fprintf(stderr, "arraySetValue: out of index\n");
+		return -1;
+	}
+
+	memcpy(slotAt(array, index), value, array->elemSize);
+	return 0;
+}
+
 void *arraySet(Array *array, int index, void *newData) {
 	if (array == NULL) {
 		fprintf(stderr, "arraySet: argument is null\n");
 		return NULL;
 	}
 
+	if (array->byValue) {
+		fprintf(stderr, "arraySet: array stores values, use arraySetValue\n");
+		return NULL;
+	}
+
 	if (index < 0 || index >= array->count) {
 		fprintf(stderr, "arraySet: out of index\n");
 		return NULL;
 	}
 
-	void *oldData = array->contents[index];
-	array->contents[index] = newData;
-	return 0;
+	void **slot = (void **)slotAt(array, index);
+	void *oldData = *slot;
+	*slot = newData;
+	return oldData;
 }
 
-int arrayInsert(Array *array, int index, void *newData) {
-	if (array == NULL) {
-		fprintf(stderr, "arrayInsert: argument is null\n");
+int arrayInsertValue(Array *array, int index, const void *value) {
+	if (array == NULL || value == NULL) {
+		fprintf(stderr, "arrayInsertValue: argument is null\n");
 		return -1;
 	}
 
 	if (increaseSize(array, array->count + 1) == -1) {
-		fprintf(stderr, "arrayInsert : memory allocation failed\n");
+		fprintf(stderr, "arrayInsertValue : memory allocation failed\n");
 		return -1;
 	}
 
 	if (index < 0 || index >= array->count) {
-		fprintf(stderr, "arrayInsert: out of index\n");
+		fprintf(stderr, "arrayInsertValue: out of index\n");
 		return -1;
 	}
 
-	memmove(array->contents + index + 1, array->contents + index,
-		sizeof(void *) * (array->count - index));
+	memmove(slotAt(array, index + 1), slotAt(array, index),
+		array->elemSize * (array->count - index));
 
-	array->contents[index] = newData;
+	memcpy(slotAt(array, index), value, array->elemSize);
 	++(array->count);
 	return 0;
 }
 
+int arrayInsert(Array *array, int index, void *newData) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayInsert: argument is null\n");
+		return -1;
+	}
+
+	if (array->byValue) {
+		fprintf(stderr, "arrayInsert: array stores values, use arrayInsertValue\n");
+		return -1;
+	}
+	return arrayInsertValue(array, index, &newData);
+}
+
 int arrayCount(const Array *array) {
 	if (array == NULL) {
 		fprintf(stderr, "arrayCount: argument is null\n");
@@ -150,6 +312,21 @@ int arrayCount(const Array *array) {
 	return array->count;
 }
 
+int arrayGetValue(const Array *array, int index, void *outValue) {
+	if (array == NULL || outValue == NULL) {
+		fprintf(stderr, "arrayGetValue: argument is null\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= array->count) {
+		fprintf(stderr, "arrayGetValue: out of index\n");
+		return -1;
+	}
+
+	memcpy(outValue, slotAt(array, index), array->elemSize);
+	return 0;
+}
+
 void *arrayGet(const Array *array, int index) {
 	if (array == NULL) {
 		fprintf(stderr, "arrayGet: argument is null\n");
@@ -160,31 +337,735 @@ void *arrayGet(const Array *array, int index) {
 		fprintf(stderr, "arrayGet: out of index\n");
 		return NULL;
 	}
-	return array->contents[index];
+
+	if (array->byValue)
+		return slotAt(array, index);
+	return *(void **)slotAt(array, index);
 }
 
-void *arrayRemove(Array *array, int index) {
+int arrayRemoveValue(Array *array, int index, void *outValue) {
 	if (array == NULL) {
-		fprintf(stderr, "arrayRemove: argument is null\n");
-		return NULL;
+		fprintf(stderr, "arrayRemoveValue: argument is null\n");
+		return -1;
 	}
 
 	if (array->count == 0) {
-		fprintf(stderr, "arrayRemove: array is empty\n");
-		return NULL;
+		fprintf(stderr, "arrayRemoveValue: array is empty\n");
+		return -1;
 	}
 
 	if (index < 0 || index >= array->count) {
-		fprintf(stderr, "arrayRemove: out of index\n");
-		return NULL;
+		fprintf(stderr, "arrayRemoveValue: out of index\n");
+		return -1;
 	}
 
-	void *oldData = array->contents[index];
+	if (outValue != NULL)
+		memcpy(outValue, slotAt(array, index), array->elemSize);
 
 	int newCount = array->count - 1;
 	if (index != newCount){
-		memmove(array->contents + index, array->contents + index + 1,
-			sizeof(void *) * (newCount - index));
+		memmove(slotAt(array, index), slotAt(array, index + 1),
+			array->elemSize * (newCount - index));
+	}
+	array->count = newCount;
+	decreaseSize(array);
+	return 0;
+}
+
+void *arrayRemove(Array *array, int index) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayRemove: argument is null\n");
+		return NULL;
 	}
+
+	if (array->byValue) {
+		fprintf(stderr, "arrayRemove: array stores values, use arrayRemoveValue\n");
+		return NULL;
+	}
+
+	void *oldData;
+	if (arrayRemoveValue(array, index, &oldData) == -1)
+		return NULL;
 	return oldData;
-}
\ No newline at end of file
+}
+
+int arrayReserve(Array *array, int capacity) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayReserve: argument is null\n");
+		return -1;
+	}
+
+	if (capacity <= array->size)
+		return 0;
+	return increaseSize(array, capacity);
+}
+
+int arrayCapacity(const Array *array) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayCapacity: argument is null\n");
+		return -1;
+	}
+	return array->size;
+}
+
+int arrayAddRange(Array *array, const void *elements, int n) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayAddRange: argument is null\n");
+		return -1;
+	}
+	return arrayInsertRange(array, array->count, elements, n);
+}
+
+// index may be equal to count, which appends the elements.
+int arrayInsertRange(Array *array, int index, const void *elements, int n) {
+	if (array == NULL || elements == NULL) {
+		fprintf(stderr, "arrayInsertRange: argument is null\n");
+		return -1;
+	}
+
+	if (index < 0 || index > array->count || n < 0 || n > MAX_SIZE - array->count) {
+		fprintf(stderr, "arrayInsertRange: out of index\n");
+		return -1;
+	}
+
+	if (n == 0)
+		return 0;
+
+	if (increaseSize(array, array->count + n) == -1) {
+		fprintf(stderr, "arrayInsertRange : memory allocation failed\n");
+		return -1;
+	}
+
+	if (index != array->count) {
+		memmove(slotAt(array, index + n), slotAt(array, index),
+			array->elemSize * (array->count - index));
+	}
+	memcpy(slotAt(array, index), elements, array->elemSize * n);
+	array->count += n;
+	return 0;
+}
+
+// outElements receives the removed elements if it isn't NULL.
+int arrayRemoveRange(Array *array, int index, int n, void *outElements) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayRemoveRange: argument is null\n");
+		return -1;
+	}
+
+	if (index < 0 || n < 0 || n > array->count - index) {
+		fprintf(stderr, "arrayRemoveRange: out of index\n");
+		return -1;
+	}
+
+	if (outElements != NULL)
+		memcpy(outElements, slotAt(array, index), array->elemSize * n);
+
+	int tail = array->count - index - n;
+	if (n != 0 && tail != 0) {
+		memmove(slotAt(array, index), slotAt(array, index + n),
+			array->elemSize * tail);
+	}
+	array->count -= n;
+	decreaseSize(array);
+	return 0;
+}
+
+// Sorting and searching ==========================================
+
+#define INSERTION_RUN (32)
+#define PARALLEL_THRESHOLD (1 << 16)  // smaller arrays are sorted by one thread.
+
+typedef struct SortContext {
+	size_t elemSize;
+	int byValue;
+	CompareFunction compare;
+}SortContext;
+
+static int compareSlots(const SortContext *ctx, const char *slot1, const char *slot2) {
+	if (ctx->byValue)
+		return ctx->compare(slot1, slot2);
+	return ctx->compare(*(void *const *)slot1, *(void *const *)slot2);
+}
+
+// Stable merge of a[0..m) and b[0..n) into dst.
+static void mergeSlots(const SortContext *ctx, const char *a, size_t m, const char *b, size_t n, char *dst) {
+	size_t size = ctx->elemSize;
+	const char *aEnd = a + m * size;
+	const char *bEnd = b + n * size;
+	while (a < aEnd && b < bEnd) {
+		if (compareSlots(ctx, b, a) < 0) {
+			memcpy(dst, b, size);
+			b += size;
+		}
+		else {
+			memcpy(dst, a, size);
+			a += size;
+		}
+		dst += size;
+	}
+	memcpy(dst, a, aEnd - a);
+	memcpy(dst + (aEnd - a), b, bEnd - b);
+}
+
+// Bottom-up merge sort of base[0..n), using tmp[0..n) as the other buffer.
+static int sortRun(const SortContext *ctx, char *base, char *tmp, size_t n) {
+	size_t size = ctx->elemSize;
+	char *hold = malloc(size);
+	if (hold == NULL) {
+		fprintf(stderr, "sortRun : malloc failed.\n");
+		return -1;
+	}
+
+	for (size_t start = 0; start < n; start += INSERTION_RUN) {
+		size_t end = (n - start < INSERTION_RUN) ? n : start + INSERTION_RUN;
+		for (size_t i = start + 1; i < end; i++) {
+			size_t j = i;
+			memcpy(hold, base + i * size, size);
+			while (j > start && compareSlots(ctx, hold, base + (j - 1) * size) < 0) {
+				memcpy(base + j * size, base + (j - 1) * size, size);
+				j--;
+			}
+			memcpy(base + j * size, hold, size);
+		}
+	}
+	free(hold);
+
+	char *src = base;
+	char *dst = tmp;
+	for (size_t width = INSERTION_RUN; width < n; width *= 2) {
+		for (size_t i = 0; i < n; i += 2 * width) {
+			size_t m = (n - i < width) ? n - i : width;
+			size_t rest = n - i - m;
+			mergeSlots(ctx, src + i * size, m, src + (i + m) * size, (rest < width) ? rest : width, dst + i * size);
+		}
+		char *t = src;
+		src = dst;
+		dst = t;
+	}
+	if (src != base)
+		memcpy(base, src, n * size);
+	return 0;
+}
+
+// Number of elements taken from a among the first k outputs of the stable merge.
+static size_t coRank(const SortContext *ctx, size_t k, const char *a, size_t m, const char *b, size_t n) {
+	size_t size = ctx->elemSize;
+	size_t lo = (k > n) ? k - n : 0;
+	size_t hi = (k < m) ? k : m;
+	while (lo < hi) {
+		size_t i = lo + (hi - lo) / 2;
+		size_t j = k - i;
+		if (j > 0 && compareSlots(ctx, a + i * size, b + (j - 1) * size) <= 0)
+			lo = i + 1;
+		else
+			hi = i;
+	}
+	return lo;
+}
+
+typedef struct SortTask {
+	const SortContext *ctx;
+	char *a;
+	size_t m;
+	char *b;
+	size_t n;
+	char *dst;
+	size_t begin;  // outputs [begin, end) of merging a and b,
+	size_t end;  // or the whole run a[0..m) to sort if b is NULL.
+	int result;
+}SortTask;
+
+static int sortTask(void *arg) {
+	SortTask *task = arg;
+	const SortContext *ctx = task->ctx;
+
+	if (task->b == NULL) {
+		task->result = sortRun(ctx, task->a, task->dst, task->m);
+		return 0;
+	}
+
+	size_t size = ctx->elemSize;
+	size_t i0 = coRank(ctx, task->begin, task->a, task->m, task->b, task->n);
+	size_t i1 = coRank(ctx, task->end, task->a, task->m, task->b, task->n);
+	size_t j0 = task->begin - i0;
+	size_t j1 = task->end - i1;
+	mergeSlots(ctx, task->a + i0 * size, i1 - i0, task->b + j0 * size, j1 - j0, task->dst + task->begin * size);
+	task->result = 0;
+	return 0;
+}
+
+// Runs the last task on the calling thread and the others on new threads.
+static int runTasks(SortTask *tasks, int count) {
+	thrd_t threads[SORT_THREADS];
+	int started[SORT_THREADS] = { 0 };
+
+	for (int i = 0; i < count - 1; i++) {
+		started[i] = (thrd_create(&threads[i], sortTask, tasks + i) == thrd_success);
+		if (!started[i])
+			sortTask(tasks + i);
+	}
+	sortTask(tasks + count - 1);
+
+	int result = 0;
+	for (int i = 0; i < count; i++) {
+		if (i < count - 1 && started[i])
+			thrd_join(threads[i], NULL);
+		if (tasks[i].result == -1)
+			result = -1;
+	}
+	return result;
+}
+
+// Parallel merge sort : SORT_THREADS runs are sorted at the same time,
+// then merged pairwise. Every merge is split between the threads by co-ranking.
+int arraySort(Array *array, CompareFunction compare) {
+	if (array == NULL || compare == NULL) {
+		fprintf(stderr, "arraySort: argument is null\n");
+		return -1;
+	}
+
+	size_t n = array->count;
+	if (n < 2)
+		return 0;
+
+	size_t size = array->elemSize;
+	char *tmp = malloc(n * size);
+	if (tmp == NULL) {
+		fprintf(stderr, "arraySort : malloc failed.\n");
+		return -1;
+	}
+
+	SortContext ctx = { size, array->byValue, compare };
+	SortTask tasks[SORT_THREADS];
+	size_t bounds[SORT_THREADS + 1];
+	int runs = (n < PARALLEL_THRESHOLD) ? 1 : SORT_THREADS;
+	for (int i = 0; i <= runs; i++)
+		bounds[i] = n * i / runs;
+
+	char *src = storage(array);
+	char *dst = tmp;
+	for (int i = 0; i < runs; i++) {
+		SortTask task = { &ctx, src + bounds[i] * size, bounds[i + 1] - bounds[i], NULL, 0, dst + bounds[i] * size, 0, 0, 0 };
+		tasks[i] = task;
+	}
+	if (runTasks(tasks, runs) == -1) {
+		free(tmp);
+		return -1;
+	}
+
+	while (runs > 1) {
+		int pairs = runs / 2;
+		int pieces = (SORT_THREADS - runs % 2) / pairs;
+		int count = 0;
+		for (int p = 0; p < runs; p += 2) {
+			size_t start = bounds[p];
+			size_t mid = bounds[p + 1];
+			size_t end = (p + 1 < runs) ? bounds[p + 2] : mid;
+			int parts = (p + 1 < runs) ? pieces : 1;
+			for (int k = 0; k < parts; k++) {
+				SortTask task = { &ctx, src + start * size, mid - start, src + mid * size, end - mid,
+					dst + start * size, (end - start) * k / parts, (end - start) * (k + 1) / parts, 0 };
+				tasks[count++] = task;
+			}
+		}
+		runTasks(tasks, count);
+
+		int newRuns = 0;
+		for (int p = 0; p < runs; p += 2)
+			bounds[newRuns++] = bounds[p];
+		bounds[newRuns] = n;
+		runs = newRuns;
+
+		char *t = src;
+		src = dst;
+		dst = t;
+	}
+
+	if (src != storage(array))
+		memcpy(storage(array), src, n * size);
+	free(tmp);
+	return 0;
+}
+
+// Index of the first element that is not less than key, or count.
+int arrayLowerBound(const Array *array, const void *key, CompareFunction compare) {
+	if (array == NULL || compare == NULL) {
+		fprintf(stderr, "arrayLowerBound: argument is null\n");
+		return -1;
+	}
+
+	int lo = 0;
+	int hi = array->count;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (compare(key, arrayGet(array, mid)) > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+int arrayBinarySearch(const Array *array, const void *key, CompareFunction compare) {
+	int index = arrayLowerBound(array, key, compare);
+	if (index == -1 || index == array->count)
+		return -1;
+	if (compare(key, arrayGet(array, index)) != 0)
+		return -1;
+	return index;
+}
+
+Array *arrayMergeSorted(const Array *array1, const Array *array2, CompareFunction compare) {
+	if (array1 == NULL || array2 == NULL || compare == NULL) {
+		fprintf(stderr, "arrayMergeSorted: argument is null\n");
+		return NULL;
+	}
+
+	if (array1->elemSize != array2->elemSize || array1->byValue != array2->byValue) {
+		fprintf(stderr, "arrayMergeSorted: element types differ\n");
+		return NULL;
+	}
+
+	Array *merged = array1->byValue ? arrayCreateSized(array1->elemSize) : arrayCreate();
+	if (merged == NULL)
+		return NULL;
+
+	int count = array1->count + array2->count;
+	if (count != 0 && arrayReserve(merged, count) == -1) {
+		arrayDestroy(merged);
+		return NULL;
+	}
+
+	SortContext ctx = { array1->elemSize, array1->byValue, compare };
+	if (count != 0)
+		mergeSlots(&ctx, storage(array1), array1->count, storage(array2), array2->count, storage(merged));
+	merged->count = count;
+	return merged;
+}
+
+// Scan kernels. count32 returns how many values are in [low, high];
+// filter32 also copies them to out.
+// The slots are read through may_alias types : they hold void pointers, or
+// values written with memcpy, so plain int32_t/int64_t loads would break strict aliasing.
+#if defined(__GNUC__) || defined(__clang__)
+typedef int32_t __attribute__((may_alias)) ScanInt32;
+typedef int64_t __attribute__((may_alias)) ScanInt64;
+#else
+typedef int32_t ScanInt32;
+typedef int64_t ScanInt64;
+#endif
+
+typedef struct ScanKernels {
+	int (*find32)(const ScanInt32 *values, int n, int32_t key);
+	int (*find64)(const ScanInt64 *values, int n, int64_t key);
+	int (*count32)(const ScanInt32 *values, int n, int32_t low, int32_t high);
+	int (*filter32)(const ScanInt32 *values, int n, int32_t low, int32_t high, ScanInt32 *out);
+}ScanKernels;
+
+static int find32Scalar(const ScanInt32 *values, int n, int32_t key) {
+	for (int i = 0; i < n; i++)
+		if (values[i] == key)
+			return i;
+	return -1;
+}
+
+static int find64Scalar(const ScanInt64 *values, int n, int64_t key) {
+	for (int i = 0; i < n; i++)
+		if (values[i] == key)
+			return i;
+	return -1;
+}
+
+static int count32Scalar(const ScanInt32 *values, int n, int32_t low, int32_t high) {
+	int count = 0;
+	for (int i = 0; i < n; i++)
+		count += (values[i] >= low && values[i] <= high);
+	return count;
+}
+
+static int filter32Scalar(const ScanInt32 *values, int n, int32_t low, int32_t high, ScanInt32 *out) {
+	int count = 0;
+	for (int i = 0; i < n; i++)
+		if (values[i] >= low && values[i] <= high)
+			out[count++] = values[i];
+	return count;
+}
+
+static const ScanKernels scalarKernels = { find32Scalar, find64Scalar, count32Scalar, filter32Scalar };
+static const ScanKernels *scanKernels = &scalarKernels;
+
+#ifdef SIMD_X86
+static int lowestBit(unsigned mask) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (int)index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+// Copies the lanes whose bit is set in mask.
+static int emitLanes(const ScanInt32 *values, unsigned mask, ScanInt32 *out) {
+	int count = 0;
+	while (mask != 0) {
+		out[count++] = values[lowestBit(mask)];
+		mask &= mask - 1;
+	}
+	return count;
+}
+
+TARGET_SSE2 static int find32Sse2(const ScanInt32 *values, int n, int32_t key) {
+	__m128i k = _mm_set1_epi32(key);
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(values + i)), k);
+		unsigned mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(eq));
+		if (mask != 0)
+			return i + lowestBit(mask);
+	}
+	int rest = find32Scalar(values + i, n - i, key);
+	return (rest == -1) ? -1 : i + rest;
+}
+
+// SSE2 has no 64-bit compare : both halves of a lane must be equal.
+TARGET_SSE2 static int find64Sse2(const ScanInt64 *values, int n, int64_t key) {
+	__m128i k = _mm_set1_epi64x(key);
+	int i = 0;
+	for (; i + 2 <= n; i += 2) {
+		__m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(values + i)), k);
+		eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+		unsigned mask = (unsigned)_mm_movemask_pd(_mm_castsi128_pd(eq));
+		if (mask != 0)
+			return i + lowestBit(mask);
+	}
+	int rest = find64Scalar(values + i, n - i, key);
+	return (rest == -1) ? -1 : i + rest;
+}
+
+TARGET_SSE2 static __m128i outside32Sse2(__m128i v, __m128i low, __m128i high) {
+	return _mm_or_si128(_mm_cmpgt_epi32(low, v), _mm_cmpgt_epi32(v, high));
+}
+
+// Each lane of outside adds -1 to its counter.
+TARGET_SSE2 static int count32Sse2(const ScanInt32 *values, int n, int32_t low, int32_t high) {
+	__m128i lo = _mm_set1_epi32(low);
+	__m128i hi = _mm_set1_epi32(high);
+	__m128i outside = _mm_setzero_si128();
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+		outside = _mm_add_epi32(outside, outside32Sse2(v, lo, hi));
+	}
+
+	int32_t lanes[4];
+	_mm_storeu_si128((__m128i *)lanes, outside);
+	return i + lanes[0] + lanes[1] + lanes[2] + lanes[3] + count32Scalar(values + i, n - i, low, high);
+}
+
+TARGET_SSE2 static int filter32Sse2(const ScanInt32 *values, int n, int32_t low, int32_t high, ScanInt32 *out) {
+	__m128i lo = _mm_set1_epi32(low);
+	__m128i hi = _mm_set1_epi32(high);
+	int count = 0;
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+		unsigned mask = ~(unsigned)_mm_movemask_ps(_mm_castsi128_ps(outside32Sse2(v, lo, hi))) & 0xF;
+		count += emitLanes(values + i, mask, out + count);
+	}
+	return count + filter32Scalar(values + i, n - i, low, high, out + count);
+}
+
+TARGET_AVX2 static int find32Avx2(const ScanInt32 *values, int n, int32_t key) {
+	__m256i k = _mm256_set1_epi32(key);
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(values + i)), k);
+		unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(eq));
+		if (mask != 0)
+			return i + lowestBit(mask);
+	}
+	int rest = find32Scalar(values + i, n - i, key);
+	return (rest == -1) ? -1 : i + rest;
+}
+
+TARGET_AVX2 static int find64Avx2(const ScanInt64 *values, int n, int64_t key) {
+	__m256i k = _mm256_set1_epi64x(key);
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(values + i)), k);
+		unsigned mask = (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(eq));
+		if (mask != 0)
+			return i + lowestBit(mask);
+	}
+	int rest = find64Scalar(values + i, n - i, key);
+	return (rest == -1) ? -1 : i + rest;
+}
+
+TARGET_AVX2 static __m256i outside32Avx2(__m256i v, __m256i low, __m256i high) {
+	return _mm256_or_si256(_mm256_cmpgt_epi32(low, v), _mm256_cmpgt_epi32(v, high));
+}
+
+TARGET_AVX2 static int count32Avx2(const ScanInt32 *values, int n, int32_t low, int32_t high) {
+	__m256i lo = _mm256_set1_epi32(low);
+	__m256i hi = _mm256_set1_epi32(high);
+	__m256i outside = _mm256_setzero_si256();
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+		outside = _mm256_add_epi32(outside, outside32Avx2(v, lo, hi));
+	}
+
+	int32_t lanes[8];
+	_mm256_storeu_si256((__m256i *)lanes, outside);
+	int count = i;
+	for (int j = 0; j < 8; j++)
+		count += lanes[j];
+	return count + count32Scalar(values + i, n - i, low, high);
+}
+
+TARGET_AVX2 static int filter32Avx2(const ScanInt32 *values, int n, int32_t low, int32_t high, ScanInt32 *out) {
+	__m256i lo = _mm256_set1_epi32(low);
+	__m256i hi = _mm256_set1_epi32(high);
+	int count = 0;
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+		unsigned mask = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(outside32Avx2(v, lo, hi))) & 0xFF;
+		count += emitLanes(values + i, mask, out + count);
+	}
+	return count + filter32Scalar(values + i, n - i, low, high, out + count);
+}
+
+static const ScanKernels sse2Kernels = { find32Sse2, find64Sse2, count32Sse2, filter32Sse2 };
+static const ScanKernels avx2Kernels = { find32Avx2, find64Avx2, count32Avx2, filter32Avx2 };
+
+static int hasAvx2(void) {
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return 0;
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6)  // the OS must save the ymm registers.
+		return 0;
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static int hasSse2(void) {
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 1);
+	return (info[3] & (1 << 26)) != 0;
+#else
+	return __builtin_cpu_supports("sse2");
+#endif
+}
+#endif
+
+static once_flag scanOnce = ONCE_FLAG_INIT;
+
+static void selectKernels(void) {
+#ifdef SIMD_X86
+	if (hasAvx2())
+		scanKernels = &avx2Kernels;
+	else if (hasSse2())
+		scanKernels = &sse2Kernels;
+#endif
+}
+
+static const ScanKernels *kernels(void) {
+	call_once(&scanOnce, selectKernels);
+	return scanKernels;
+}
+
+static int storesValuesOf(const Array *array, size_t elemSize, const char *caller) {
+	if (!array->byValue || array->elemSize != elemSize) {
+		fprintf(stderr, "%s: array doesn't store %zu-byte integers\n", caller, elemSize);
+		return 0;
+	}
+	return 1;
+}
+
+int arrayIndexOf(const Array *array, const void *data) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayIndexOf: argument is null\n");
+		return -1;
+	}
+
+	if (array->byValue) {
+		fprintf(stderr, "arrayIndexOf: array stores values, use arrayFindInt32 or arrayFindInt64\n");
+		return -1;
+	}
+
+	if (sizeof(void *) == sizeof(int64_t))
+		return kernels()->find64((const ScanInt64 *)storage(array), array->count, (int64_t)(intptr_t)data);
+	return kernels()->find32((const ScanInt32 *)storage(array), array->count, (int32_t)(intptr_t)data);
+}
+
+int arrayFindInt32(const Array *array, int32_t value) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayFindInt32: argument is null\n");
+		return -1;
+	}
+
+	if (!storesValuesOf(array, sizeof(int32_t), "arrayFindInt32"))
+		return -1;
+	return kernels()->find32((const ScanInt32 *)storage(array), array->count, value);
+}
+
+int arrayFindInt64(const Array *array, int64_t value) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayFindInt64: argument is null\n");
+		return -1;
+	}
+
+	if (!storesValuesOf(array, sizeof(int64_t), "arrayFindInt64"))
+		return -1;
+	return kernels()->find64((const ScanInt64 *)storage(array), array->count, value);
+}
+
+int arrayCountIf(const Array *array, int32_t low, int32_t high) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayCountIf: argument is null\n");
+		return -1;
+	}
+
+	if (!storesValuesOf(array, sizeof(int32_t), "arrayCountIf"))
+		return -1;
+	return kernels()->count32((const ScanInt32 *)storage(array), array->count, low, high);
+}
+
+// Counts first, so out grows once to the exact size.
+int arrayFilterInto(const Array *array, int32_t low, int32_t high, Array *out) {
+	if (array == NULL || out == NULL) {
+		fprintf(stderr, "arrayFilterInto: argument is null\n");
+		return -1;
+	}
+
+	if (array == out) {
+		fprintf(stderr, "arrayFilterInto: out must be another array\n");
+		return -1;
+	}
+
+	if (!storesValuesOf(array, sizeof(int32_t), "arrayFilterInto") ||
+		!storesValuesOf(out, sizeof(int32_t), "arrayFilterInto"))
+		return -1;
+
+	int n = arrayCountIf(array, low, high);
+	if (n == 0)
+		return 0;
+	if (n > MAX_SIZE - out->count || increaseSize(out, out->count + n) == -1) {
+		fprintf(stderr, "arrayFilterInto : memory allocation failed\n");
+		return -1;
+	}
+
+	kernels()->filter32((const ScanInt32 *)storage(array), array->count, low, high,
+		(ScanInt32 *)slotAt(out, out->count));
+	out->count += n;
+	return n;
+}
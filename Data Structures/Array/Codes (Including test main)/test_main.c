@@ -14,6 +14,12 @@ const char *toPerson(const void *data) {
 	return (const char *)buf;
 }
 
+int comparePerson(const void *data1, const void *data2) {
+	const Person *p1 = data1;
+	const Person *p2 = data2;
+	return (p1->age - p2->age);
+}
+
 int main() {
 	Array *arr = arrayCreate();
 	Person people[5] = {
@@ -29,4 +35,78 @@ int main() {
 	arrayDisplay(arr, toPerson);
 
 	arrayDestroy(arr);
+
+	// The array below keeps copies of people, not pointers to them.
+	Array *values = arrayCreateSized(sizeof(Person));
+	for (int i = 0; i < 4; i++) {
+		arrayAddValue(values, people + i);
+	}
+
+	Person second = { "S", 99 };
+	arrayInsertValue(values, 1, &second);
+	arrayDisplay(values, toPerson);
+
+	Person removed;
+	arrayRemoveValue(values, 0, &removed);
+	printf("removed : %s\n", toPerson(&removed));
+	arrayDisplay(values, toPerson);
+
+	arrayDestroy(values);
+
+	// Range functions : one capacity check and one memmove per call.
+	Array *batch = arrayCreate();
+	void *group[3] = { people + 1, people + 2, people + 3 };
+	arrayReserve(batch, 10);
+	printf("capacity after arrayReserve(10) : %d\n", arrayCapacity(batch));  // 16
+	arrayAdd(batch, people);
+	arrayAdd(batch, people + 4);
+	arrayInsertRange(batch, 1, group, 3);
+	arrayDisplay(batch, toPerson);
+
+	void *removedGroup[2];
+	arrayRemoveRange(batch, 0, 2, removedGroup);
+	arrayAddRange(batch, removedGroup, 2);
+	arrayDisplay(batch, toPerson);
+
+	// Sorting and searching by age.
+	arraySort(batch, comparePerson);
+	arrayDisplay(batch, toPerson);
+
+	Person key = { "KEY", 33 };
+	printf("index of age 33 : %d\n", arrayBinarySearch(batch, &key, comparePerson));
+
+	Array *merged = arrayMergeSorted(batch, batch, comparePerson);
+	arrayDisplay(merged, toPerson);
+
+	arrayDestroy(merged);
+	arrayDestroy(batch);
+
+	// A local Array needs no allocation until it holds more than INLINE_SIZE pointers.
+	Array local;
+	arrayInit(&local);
+	for (int i = 0; i < 5; i++) {
+		arrayAdd(&local, people + i);
+		arrayDisplay(&local, toPerson);
+		printf("%d pointers, %s\n", arrayCount(&local),
+			(arrayCapacity(&local) == INLINE_SIZE) ? "inline" : "on the heap");
+	}
+	printf("index of E : %d\n", arrayIndexOf(&local, people + 4));
+	arrayRelease(&local);
+
+	// Typed scans over int32_t values.
+	Array *ages = arrayCreateSized(sizeof(int32_t));
+	Array *adults = arrayCreateSized(sizeof(int32_t));
+	for (int i = 0; i < 5; i++) {
+		int32_t age = people[i].age;
+		arrayAddValue(ages, &age);
+	}
+	printf("index of 44 : %d\n", arrayFindInt32(ages, 44));
+	printf("ages in [20, 50] : %d\n", arrayCountIf(ages, 20, 50));
+	arrayFilterInto(ages, 20, 50, adults);
+	for (int i = 0; i < arrayCount(adults); i++)
+		printf("%d ", *(int32_t *)arrayGet(adults, i));
+	printf("\n");
+
+	arrayDestroy(adults);
+	arrayDestroy(ages);
 }
\ No newline at end of file
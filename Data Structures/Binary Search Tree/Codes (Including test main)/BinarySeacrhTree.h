@@ -5,12 +5,13 @@
 
 typedef struct Node Node;
 typedef struct BST BST;
+typedef struct FrozenBST FrozenBST;
 
 typedef const char *(*DisplayFunction)(void *data);
 typedef int (*CompareFunction)(void *data1, void *data2);
-typedef size_t(*SizeFunction)();
+typedef int (*KeyFunction)(void *data);
 
-BST *bstCreate(DisplayFunction, CompareFunction, SizeFunction);
+BST *bstCreate(DisplayFunction, CompareFunction);
 int bstInsert(BST *bst, void *data);
 void preorder(const BST *bst);
 void inorder(const BST *bst);
@@ -18,4 +19,17 @@ void postorder(const BST *bst);
 void *bstGet(BST *bst, void *key);
 void *bstRemove(BST *bst, void *key);
 
+// In splay mode every bstGet() moves the found node to the root,
+// so frequently accessed keys stay near the top.
+int bstSetSplay(BST *bst, int enable);
+
+// Read-only snapshot of a BST laid out without child pointers.
+// bstFreeze() uses the Eytzinger (BFS) order, bstFreezeInt() uses a static
+// B-tree of int keys so that each node is searched with one SIMD compare.
+FrozenBST *bstFreeze(const BST *bst);
+FrozenBST *bstFreezeInt(const BST *bst, KeyFunction keyFunction);
+void *frozenGet(const FrozenBST *frozen, void *key);
+void *frozenGetInt(const FrozenBST *frozen, int key);
+void frozenDestroy(FrozenBST *frozen);
+
 #endif
\ No newline at end of file
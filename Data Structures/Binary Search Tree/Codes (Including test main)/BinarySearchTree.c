@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 #include "BinarySeacrhTree.h"
 
 typedef struct Node {
@@ -12,10 +14,10 @@ typedef struct BST {
 	Node *root;
 	DisplayFunction displayFunction;
 	CompareFunction compareFunction;
-	SizeFunction sizeFunction;
+	int splay;
 }BST;
 
-BST *bstCreate(DisplayFunction displayFunction, CompareFunction compareFunction, SizeFunction sizeFunction) {
+BST *bstCreate(DisplayFunction displayFunction, CompareFunction compareFunction) {
 
 	if (displayFunction == NULL || compareFunction == NULL) {
 		fprintf(stderr, "bstCreate : argument is NULL.\n");
@@ -29,7 +31,6 @@ BST *bstCreate(DisplayFunction displayFunction, CompareFunction compareFunction,
 	}
 	bst->displayFunction = displayFunction;
 	bst->compareFunction = compareFunction;
-	bst->sizeFunction = sizeFunction;
 	return bst;
 }
 
@@ -117,15 +118,95 @@ void postorder(const BST *bst) {
 	printf("\n");
 }
 
+int bstSetSplay(BST *bst, int enable) {
+	if (bst == NULL) {
+		fprintf(stderr, "bstSetSplay : argument is NULL.\n");
+		return -1;
+	}
+	bst->splay = enable;
+	return 0;
+}
+
+// Top-down splay : the last node on the search path for key becomes the root.
+// Every node on the path is compared once, and *found tells whether key is the new root.
+static Node *splay(const BST *bst, Node *root, void *key, int *found) {
+	Node header = { NULL, NULL, NULL };
+	Node *leftMax = &header;
+	Node *rightMin = &header;
+	Node *t = root;
+
+	int cmp = bst->compareFunction(key, t->data);
+	while (cmp != 0) {
+		if (cmp < 0) {
+			if (t->left == NULL)
+				break;
+			cmp = bst->compareFunction(key, t->left->data);
+			if (cmp < 0) {
+				Node *child = t->left;
+				t->left = child->right;
+				child->right = t;
+				t = child;
+				if (t->left == NULL)
+					break;
+				rightMin->left = t;
+				rightMin = t;
+				t = t->left;
+				cmp = bst->compareFunction(key, t->data);
+			}
+			else {
+				rightMin->left = t;
+				rightMin = t;
+				t = t->left;
+			}
+		}
+		else {
+			if (t->right == NULL)
+				break;
+			cmp = bst->compareFunction(key, t->right->data);
+			if (cmp > 0) {
+				Node *child = t->right;
+				t->right = child->left;
+				child->left = t;
+				t = child;
+				if (t->right == NULL)
+					break;
+				leftMax->right = t;
+				leftMax = t;
+				t = t->right;
+				cmp = bst->compareFunction(key, t->data);
+			}
+			else {
+				leftMax->right = t;
+				leftMax = t;
+				t = t->right;
+			}
+		}
+	}
+
+	leftMax->right = t->left;
+	rightMin->left = t->right;
+	t->left = header.right;
+	t->right = header.left;
+	*found = (cmp == 0);
+	return t;
+}
+
 void *bstGet(BST *bst, void *key) {
 	if (bst->root == NULL)
 		return NULL;
 
+	if (bst->splay) {
+		int found;
+		bst->root = splay(bst, bst->root, key, &found);
+		return found ? bst->root->data : NULL;
+	}
+
 	Node *cur = bst->root;
 	while (cur != NULL) {
-		if (bst->compareFunction(key, cur->data) < 0)
+		int cmp = bst->compareFunction(key, cur->data);
+		if (cmp < 0)
 			cur = cur->left;
-		else if (bst->compareFunction(key, cur->data) > 0)
+		else if (cmp > 0)
 			cur = cur->right;
 		else
 			return cur->data;
@@ -133,16 +214,6 @@ void *bstGet(BST *bst, void *key) {
 	return NULL;
 }
 
-static void generic_swap(void *a, void *b, size_t dataSize) {
-	char *pA = (char *)a;
-	char *pB = (char *)b;
-	for (size_t i = 0; i < dataSize; i++, pA++, pB++) {
-		char t = *pA;
-		*pA = *pB;
-		*pB = t;
-	}
-}
-
 void *bstRemove(BST *bst, void *key) {
 
 	if (bst == NULL || key == NULL) {
@@ -211,16 +282,273 @@ void *bstRemove(BST *bst, void *key) {
 			candidate = candidate->left;
 		}
 
-		if (cParent->left == candidate)
+		// Relink the successor node into target's place instead of copying its data.
+		if (cParent != target) {
 			cParent->left = candidate->right;
-		else
-			cParent->right = candidate->right;
+			candidate->right = target->right;
+		}
+		candidate->left = target->left;
 
-		generic_swap(candidate->data, target->data, bst->sizeFunction());
-		target = candidate;
+		if (parent != NULL) {
+			if (target == parent->left)
+				parent->left = candidate;
+			else
+				parent->right = candidate;
+		}
+		else {
+			bst->root = candidate;
+		}
 	}
 
 	void *out = target->data;
 	free(target);
 	return out;
+}
+
+// Frozen BST ====================================================
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FROZEN_SSE2
+#endif
+
+#if defined(__GNUC__)
+#define PREFETCH(ptr) __builtin_prefetch(ptr)
+#elif defined(_MSC_VER)
+#include <xmmintrin.h>
+#define PREFETCH(ptr) _mm_prefetch((const char *)(ptr), _MM_HINT_T0)
+#else
+#define PREFETCH(ptr) ((void)0)
+#endif
+
+#define BLOCK_KEYS (16)  // 16 int keys fill one 64-byte cache line.
+#define CACHE_LINE (64)
+
+typedef struct FrozenBST {
+	void **datas;  // Eytzinger order from index 1, or B-tree slots if keys != NULL.
+	int *keys;
+	void *keyBuffer;
+	int count;
+	int blockCount;
+	CompareFunction compareFunction;
+	KeyFunction keyFunction;
+}FrozenBST;
+
+static int _countNodes(const Node *node) {
+	if (node == NULL)
+		return 0;
+	return 1 + _countNodes(node->left) + _countNodes(node->right);
+}
+
+static void _collect(const Node *node, void **out, int *index) {
+	if (node == NULL)
+		return;
+
+	_collect(node->left, out, index);
+	out[(*index)++] = node->data;
+	_collect(node->right, out, index);
+}
+
+static void **sortedDatas(const BST *bst, int *count) {
+	*count = _countNodes(bst->root);
+
+	void **sorted = malloc(sizeof(void *) * (*count + 1));
+	if (sorted == NULL) {
+		fprintf(stderr, "sortedDatas : malloc failed.\n");
+		return NULL;
+	}
+
+	int index = 0;
+	_collect(bst->root, sorted, &index);
+	return sorted;
+}
+
+// Walks the implicit tree in order, so the sorted datas land in BFS order.
+static void _eytzinger(void **sorted, void **datas, int *index, int k, int count) {
+	if (k > count)
+		return;
+
+	_eytzinger(sorted, datas, index, 2 * k, count);
+	datas[k] = sorted[(*index)++];
+	_eytzinger(sorted, datas, index, 2 * k + 1, count);
+}
+
+static void _btree(const FrozenBST *frozen, void **sorted, int *index, int k) {
+	if (k >= frozen->blockCount)
+		return;
+
+	for (int i = 0; i <= BLOCK_KEYS; i++) {
+		_btree(frozen, sorted, index, k * (BLOCK_KEYS + 1) + i + 1);
+		if (i == BLOCK_KEYS)
+			break;
+
+		int slot = k * BLOCK_KEYS + i;
+		if (*index < frozen->count) {
+			frozen->datas[slot] = sorted[*index];
+			frozen->keys[slot] = frozen->keyFunction(sorted[*index]);
+			++(*index);
+		}
+		else {
+			frozen->datas[slot] = NULL;
+			frozen->keys[slot] = INT_MAX;
+		}
+	}
+}
+
+FrozenBST *bstFreeze(const BST *bst) {
+	if (bst == NULL) {
+		fprintf(stderr, "bstFreeze : argument is NULL.\n");
+		return NULL;
+	}
+
+	FrozenBST *frozen = calloc(1, sizeof(FrozenBST));
+	if (frozen == NULL) {
+		fprintf(stderr, "bstFreeze : calloc failed.\n");
+		return NULL;
+	}
+
+	void **sorted = sortedDatas(bst, &frozen->count);
+	if (sorted == NULL) {
+		free(frozen);
+		return NULL;
+	}
+
+	frozen->datas = malloc(sizeof(void *) * (frozen->count + 1));
+	if (frozen->datas == NULL) {
+		fprintf(stderr, "bstFreeze : malloc failed.\n");
+		free(sorted);
+		free(frozen);
+		return NULL;
+	}
+
+	int index = 0;
+	_eytzinger(sorted, frozen->datas, &index, 1, frozen->count);
+	free(sorted);
+
+	frozen->compareFunction = bst->compareFunction;
+	return frozen;
+}
+
+FrozenBST *bstFreezeInt(const BST *bst, KeyFunction keyFunction) {
+	if (bst == NULL || keyFunction == NULL) {
+		fprintf(stderr, "bstFreezeInt : argument is NULL.\n");
+		return NULL;
+	}
+
+	FrozenBST *frozen = calloc(1, sizeof(FrozenBST));
+	if (frozen == NULL) {
+		fprintf(stderr, "bstFreezeInt : calloc failed.\n");
+		return NULL;
+	}
+
+	void **sorted = sortedDatas(bst, &frozen->count);
+	if (sorted == NULL) {
+		free(frozen);
+		return NULL;
+	}
+
+	frozen->blockCount = (frozen->count + BLOCK_KEYS - 1) / BLOCK_KEYS;
+	size_t slots = (size_t)frozen->blockCount * BLOCK_KEYS;
+
+	// Every block must start on a cache line, so over-allocate and align by hand.
+	frozen->keyBuffer = malloc(sizeof(int) * slots + CACHE_LINE);
+	frozen->datas = malloc(sizeof(void *) * (slots + 1));
+	if (frozen->keyBuffer == NULL || frozen->datas == NULL) {
+		fprintf(stderr, "bstFreezeInt : malloc failed.\n");
+		free(frozen->keyBuffer);
+		free(frozen->datas);
+		free(sorted);
+		free(frozen);
+		return NULL;
+	}
+	uintptr_t address = (uintptr_t)frozen->keyBuffer;
+	frozen->keys = (int *)((address + CACHE_LINE - 1) & ~(uintptr_t)(CACHE_LINE - 1));
+
+	frozen->compareFunction = bst->compareFunction;
+	frozen->keyFunction = keyFunction;
+
+	int index = 0;
+	_btree(frozen, sorted, &index, 0);
+	free(sorted);
+	return frozen;
+}
+
+void *frozenGet(const FrozenBST *frozen, void *key) {
+	if (frozen == NULL || key == NULL) {
+		fprintf(stderr, "frozenGet : argument is NULL.\n");
+		return NULL;
+	}
+
+	if (frozen->keys != NULL)
+		return frozenGetInt(frozen, frozen->keyFunction(key));
+
+	// Branchless descent : the comparison result selects the child.
+	// The 16 descendants four levels below k share one cache line of datas;
+	// near the leaves they are past the end, so k itself is prefetched instead.
+	int k = 1;
+	while (k <= frozen->count) {
+		PREFETCH(frozen->datas + ((k <= frozen->count / 16) ? 16 * k : k));
+		k = 2 * k + (frozen->compareFunction(key, frozen->datas[k]) > 0);
+	}
+
+	// Undo the right turns taken after the last left turn.
+	while (k & 1)
+		k >>= 1;
+	k >>= 1;
+
+	if (k == 0 || frozen->compareFunction(key, frozen->datas[k]) != 0)
+		return NULL;
+	return frozen->datas[k];
+}
+
+// Number of keys in the block that are smaller than key.
+static int blockRank(const int *block, int key) {
+#ifdef FROZEN_SSE2
+	__m128i needle = _mm_set1_epi32(key);
+	__m128i lt0 = _mm_cmpgt_epi32(needle, _mm_load_si128((const __m128i *)block));
+	__m128i lt1 = _mm_cmpgt_epi32(needle, _mm_load_si128((const __m128i *)block + 1));
+	__m128i lt2 = _mm_cmpgt_epi32(needle, _mm_load_si128((const __m128i *)block + 2));
+	__m128i lt3 = _mm_cmpgt_epi32(needle, _mm_load_si128((const __m128i *)block + 3));
+	__m128i packed = _mm_packs_epi16(_mm_packs_epi32(lt0, lt1), _mm_packs_epi32(lt2, lt3));
+	unsigned int mask = (unsigned int)_mm_movemask_epi8(packed);
+
+	int rank = 0;
+	for (; mask != 0; mask &= mask - 1)
+		rank++;
+	return rank;
+#else
+	int rank = 0;
+	for (int i = 0; i < BLOCK_KEYS; i++)
+		rank += (block[i] < key);
+	return rank;
+#endif
+}
+
+void *frozenGetInt(const FrozenBST *frozen, int key) {
+	if (frozen == NULL || frozen->keys == NULL) {
+		fprintf(stderr, "frozenGetInt : not frozen with int keys.\n");
+		return NULL;
+	}
+
+	// Keep the slot of the smallest key that is not less than key.
+	int found = -1;
+	int k = 0;
+	while (k < frozen->blockCount) {
+		int rank = blockRank(frozen->keys + k * BLOCK_KEYS, key);
+		if (rank < BLOCK_KEYS)
+			found = k * BLOCK_KEYS + rank;
+		k = k * (BLOCK_KEYS + 1) + rank + 1;
+	}
+
+	if (found == -1 || frozen->keys[found] != key)
+		return NULL;
+	return frozen->datas[found];
+}
+
+void frozenDestroy(FrozenBST *frozen) {
+	if (frozen == NULL)
+		return;
+	free(frozen->datas);
+	free(frozen->keyBuffer);
+	free(frozen);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 #include "BinarySeacrhTree.h"
 
 typedef struct Person {
@@ -8,10 +9,6 @@ typedef struct Person {
 	int age;
 }Person;
 
-size_t sizeOfPerson() {
-	return sizeof(Person);
-}
-
 const char *toPerson(const void *data) {
 	static char buf[32];
 	const Person *person = (const Person *)data;
@@ -25,11 +22,151 @@ int comparePerson(void *data1, void *data2) {
 	return (p1->age - p2->age);
 }
 
+int ageOfPerson(void *data) {
+	const Person *person = data;
+	return person->age;
+}
+
+// Splay benchmark : average comparisons per bstGet() on a Zipf trace.
+#define BENCH_KEYS (4096)
+#define BENCH_LOOKUPS (200000)
+
+static long compareCount;
+
+int compareCounted(void *data1, void *data2) {
+	++compareCount;
+	int a = *(const int *)data1;
+	int b = *(const int *)data2;
+	return (a > b) - (a < b);
+}
+
+const char *toInt(void *data) {
+	static char buf[16];
+	sprintf(buf, "%d", *(const int *)data);
+	return (const char *)buf;
+}
+
+double averageCompares(int splay, int *keys, int *trace) {
+	BST *bst = bstCreate(toInt, compareCounted);
+	bstSetSplay(bst, splay);
+	for (int i = 0; i < BENCH_KEYS; i++)
+		bstInsert(bst, keys + i);
+
+	compareCount = 0;
+	for (int i = 0; i < BENCH_LOOKUPS; i++)
+		bstGet(bst, trace + i);
+	return (double)compareCount / BENCH_LOOKUPS;
+}
+
+void splayBenchmark(void) {
+	static int keys[BENCH_KEYS];
+	static int trace[BENCH_LOOKUPS];
+	static double cdf[BENCH_KEYS];
+
+	// keys are inserted in random order, and the hot keys are scattered over the key range.
+	srand(1);
+	for (int i = 0; i < BENCH_KEYS; i++)
+		keys[i] = i;
+	for (int i = BENCH_KEYS - 1; i > 0; i--) {
+		int j = rand() % (i + 1);
+		int t = keys[i];
+		keys[i] = keys[j];
+		keys[j] = t;
+	}
+
+	double sum = 0;
+	for (int i = 0; i < BENCH_KEYS; i++) {
+		sum += 1.0 / (i + 1);
+		cdf[i] = sum;
+	}
+	for (int i = 0; i < BENCH_LOOKUPS; i++) {
+		double u = sum * rand() / ((double)RAND_MAX + 1);
+		int lo = 0;
+		int hi = BENCH_KEYS - 1;
+		while (lo < hi) {
+			int mid = (lo + hi) / 2;
+			if (cdf[mid] < u)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		trace[i] = (int)(lo * 2654435761u % BENCH_KEYS);
+	}
+	printf("zipf    : plain %.2f, splay %.2f compares per bstGet()\n",
+		averageCompares(0, keys, trace), averageCompares(1, keys, trace));
+
+	for (int i = 0; i < BENCH_LOOKUPS; i++)
+		trace[i] = rand() % BENCH_KEYS;
+	printf("uniform : plain %.2f, splay %.2f compares per bstGet()\n\n",
+		averageCompares(0, keys, trace), averageCompares(1, keys, trace));
+}
+
+// Frozen benchmark : the same uniform lookups on the tree and on both frozen layouts.
+#define FROZEN_KEYS (1 << 18)
+
+int compareInt(void *data1, void *data2) {
+	int a = *(const int *)data1;
+	int b = *(const int *)data2;
+	return (a > b) - (a < b);
+}
+
+int keyOfInt(void *data) {
+	return *(const int *)data;
+}
+
+void frozenBenchmark(void) {
+	static int keys[FROZEN_KEYS];
+	static int trace[BENCH_LOOKUPS];
+
+	srand(2);
+	for (int i = 0; i < FROZEN_KEYS; i++)
+		keys[i] = 2 * i;  // odd lookups miss.
+	for (int i = FROZEN_KEYS - 1; i > 0; i--) {
+		int j = (int)(((unsigned)rand() * (RAND_MAX + 1u) + (unsigned)rand()) % (unsigned)(i + 1));
+		int t = keys[i];
+		keys[i] = keys[j];
+		keys[j] = t;
+	}
+	for (int i = 0; i < BENCH_LOOKUPS; i++)
+		trace[i] = (int)(((unsigned)rand() * (RAND_MAX + 1u) + (unsigned)rand()) % (2u * FROZEN_KEYS));
+
+	BST *bst = bstCreate(toInt, compareInt);
+	for (int i = 0; i < FROZEN_KEYS; i++)
+		bstInsert(bst, keys + i);
+	FrozenBST *frozen = bstFreeze(bst);
+	FrozenBST *frozenInt = bstFreezeInt(bst, keyOfInt);
+
+	int found[3] = { 0, 0, 0 };
+	double elapsed[3];
+	clock_t start = clock();
+	for (int i = 0; i < BENCH_LOOKUPS; i++)
+		found[0] += (bstGet(bst, trace + i) != NULL);
+	elapsed[0] = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (int i = 0; i < BENCH_LOOKUPS; i++)
+		found[1] += (frozenGet(frozen, trace + i) != NULL);
+	elapsed[1] = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (int i = 0; i < BENCH_LOOKUPS; i++)
+		found[2] += (frozenGetInt(frozenInt, trace[i]) != NULL);
+	elapsed[2] = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("%d keys, %d lookups (%d found)\n", FROZEN_KEYS, BENCH_LOOKUPS, found[0]);
+	printf("bstGet()       : %.3f sec\n", elapsed[0]);
+	printf("frozenGet()    : %.3f sec%s\n", elapsed[1], (found[1] == found[0]) ? "" : " (wrong results!)");
+	printf("frozenGetInt() : %.3f sec%s\n\n", elapsed[2], (found[2] == found[0]) ? "" : " (wrong results!)");
+
+	frozenDestroy(frozen);
+	frozenDestroy(frozenInt);
+}
+
 int main() {
 
 	// This test code uses Person's age as the Node's key.
 
-	BST *bst = bstCreate(toPerson, comparePerson, sizeOfPerson);
+	BST *bst = bstCreate(toPerson, comparePerson);
 
 	Person people[8] = { {"FOUR", 40}, {"TWO", 20}, {"ONE", 10}, {"THREE", 30}, {"SIX",60}, {"FIVE", 50}, {"SEVEN", 70}, {"EIGHT", 80} };
 	for (int i = 0; i < 8; i++) {
@@ -50,6 +187,26 @@ int main() {
 			printf("%s\n", toPerson(data));
 	}
 
+	printf("========bstFreeze() test========\n\n");
+	FrozenBST *frozen = bstFreeze(bst);
+	FrozenBST *frozenInt = bstFreezeInt(bst, ageOfPerson);
+	for (int i = 0; i < 8; i++) {
+		void *data = frozenGet(frozen, people + i);
+		if (data != NULL)
+			printf("%s ", toPerson(data));
+		data = frozenGetInt(frozenInt, people[i].age);
+		if (data != NULL)
+			printf("%s\n", toPerson(data));
+	}
+	if (frozenGetInt(frozenInt, 45) == NULL)
+		printf("age 45 doesn't exist.\n");
+	frozenDestroy(frozen);
+	frozenDestroy(frozenInt);
+	frozenBenchmark();
+
+	printf("========bstSetSplay() test========\n\n");
+	splayBenchmark();
+
 	printf("========bstRemove() test========\n\n");
 
 	for (int i = 0; i < 8; i++) {
@@ -12,6 +12,7 @@ typedef struct Node {
 
 typedef struct List {
 	Node *head;
+	Node *last;  // last element, or head when the list is empty.
 	int count;
 	FreeFunction *freeFunction;
 }List;
@@ -50,6 +51,8 @@ void *listRemove(List *list, int index) {
 	Node *delNode = prev->next;
 	void *outData = delNode->data;
 	prev->next = delNode->next;
+	if (list->last == delNode)
+		list->last = prev;
 	free(delNode);
 	--(list->count);
 	return outData;
@@ -158,6 +161,7 @@ List *listInitialize(FreeFunction freeFunction) {
 
 	list->head = head;
 	head->next = head;
+	list->last = head;
 	list->count = 0;
 	list->freeFunction = freeFunction;
 	return list;
@@ -200,11 +204,8 @@ int listAdd(List *list, void *data) {
 	}
 	node->data = data;
 	node->next = list->head;
-
-	Node *cur = list->head;
-	while (cur->next != list->head)
-		cur = cur->next;
-	cur->next = node;
+	list->last->next = node;
+	list->last = node;
 	++(list->count);
 	return 0;
 }
@@ -237,6 +238,7 @@ int listReverse(List *list) {
 	Node *prev = list->head;
 	Node *cur = list->head->next;
 	Node *next;
+	list->last = cur;  // the first element ends up last.
 
 	while (cur != list->head) {
 		next = cur->next;
@@ -247,3 +249,80 @@ int listReverse(List *list) {
 	cur->next = prev;
 	return 0;
 }
+
+int listBegin(List *list, ListCursor *cursor) {
+	if (list == NULL || cursor == NULL) {
+		fprintf(stderr, "listBegin:argument is NULL.\n");
+		return -1;
+	}
+
+	cursor->list = list;
+	cursor->prev = NULL;
+	cursor->node = list->head;
+	return 0;
+}
+
+int listNext(ListCursor *cursor, void **outData) {
+	if (cursor == NULL || outData == NULL) {
+		fprintf(stderr, "listNext:argument is NULL.\n");
+		return -1;
+	}
+
+	Node *next = cursor->node->next;
+	if (next == cursor->list->head)
+		return 0;
+
+	cursor->prev = cursor->node;
+	cursor->node = next;
+	*outData = next->data;
+	return 1;
+}
+
+int listInsertAfter(ListCursor *cursor, void *data) {
+	if (cursor == NULL) {
+		fprintf(stderr, "listInsertAfter:cursor is NULL.\n");
+		return -1;
+	}
+
+	Node *node = malloc(sizeof(Node));
+	if (node == NULL) {
+		perror("listInsertAfter");
+		return -1;
+	}
+	node->data = data;
+
+	List *list = cursor->list;
+	node->next = cursor->node->next;
+	cursor->node->next = node;
+	if (list->last == cursor->node)
+		list->last = node;
+	++(list->count);
+	return 0;
+}
+
+void *listRemoveAt(ListCursor *cursor) {
+	if (cursor == NULL) {
+		fprintf(stderr, "listRemoveAt:cursor is NULL.\n");
+		return NULL;
+	}
+
+	if (cursor->prev == NULL) {
+		fprintf(stderr, "listRemoveAt:cursor is not on an element.\n");
+		return NULL;
+	}
+
+	List *list = cursor->list;
+	Node *delNode = cursor->node;
+	void *outData = delNode->data;
+	cursor->prev->next = delNode->next;
+	if (list->last == delNode)
+		list->last = cursor->prev;
+	free(delNode);
+	--(list->count);
+
+	// The previous node becomes current. Its own previous node is unknown,
+	// so the cursor has to move before removing again.
+	cursor->node = cursor->prev;
+	cursor->prev = NULL;
+	return outData;
+}
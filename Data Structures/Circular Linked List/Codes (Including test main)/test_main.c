@@ -35,6 +35,20 @@ int main() {
 	listReverse(list);
 	listDisplay(list, toPerson);
 
+	// Cursor : drop everyone older than 30 and put a new person after B, in one pass.
+	Person newcomer = { "F", 25 };
+	ListCursor cursor;
+	void *data;
+	listBegin(list, &cursor);
+	while (listNext(&cursor, &data) == 1) {
+		Person *person = data;
+		if (person->age > 30)
+			listRemoveAt(&cursor);
+		else if (person->name[0] == 'B')
+			listInsertAfter(&cursor, &newcomer);
+	}
+	listDisplay(list, toPerson);
+
 	listFinalize(list);
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <threads.h>
+#include "ConcurrentArray.h"
+
+typedef _Atomic(void *) Slot;
+
+typedef struct Array {
+	_Atomic(Slot *) segments[MAX_SEGMENTS];
+	atomic_size_t reserved;
+}Array;
+
+// Marks a segment that one thread is allocating, so the others wait for it
+// instead of allocating a copy of their own.
+static Slot claimedMarker;
+#define CLAIMED (&claimedMarker)
+
+// Slot index + INITIAL_SIZE has its highest bit in segment's position.
+static void locate(size_t index, int *segment, size_t *offset) {
+	size_t pos = index + INITIAL_SIZE;
+	int k = 0;
+	while ((pos >> k) >= 2 * INITIAL_SIZE)
+		k++;
+	*segment = k;
+	*offset = pos - ((size_t)INITIAL_SIZE << k);
+}
+
+static size_t capacity(void) {
+	size_t total = ((size_t)INITIAL_SIZE << MAX_SEGMENTS) - INITIAL_SIZE;
+	return (total < INT_MAX) ? total : INT_MAX;
+}
+
+// Allocates the segment if nobody has. Only the thread that claims it allocates;
+// if that fails the claim is dropped, so a later arrayAdd() can try again.
+static Slot *getSegment(Array *array, int k) {
+	for (;;) {
+		Slot *segment = atomic_load_explicit(&array->segments[k], memory_order_acquire);
+		if (segment == CLAIMED) {
+			thrd_yield();
+			continue;
+		}
+		if (segment != NULL)
+			return segment;
+
+		if (!atomic_compare_exchange_strong(&array->segments[k], &segment, CLAIMED))
+			continue;
+
+		Slot *newSegment = calloc((size_t)INITIAL_SIZE << k, sizeof(Slot));
+		if (newSegment == NULL)
+			perror("getSegment");
+		atomic_store_explicit(&array->segments[k], newSegment, memory_order_release);
+		return newSegment;
+	}
+}
+
+Array *arrayCreate() {
+	Array *array = calloc(1, sizeof(Array));
+	if (array == NULL) {
+		perror("arrayCreate");
+		return NULL;
+	}
+	if (getSegment(array, 0) == NULL) {
+		free(array);
+		return NULL;
+	}
+	return array;
+}
+
+void arrayDestroy(Array *array) {
+	if (array == NULL)
+		return;
+	for (int k = 0; k < MAX_SEGMENTS; k++)
+		free(atomic_load(&array->segments[k]));
+	free(array);
+}
+
+int arrayAdd(Array *array, void *data) {
+	if (array == NULL || data == NULL) {
+		fprintf(stderr, "arrayAdd: argument is null\n");
+		return -1;
+	}
+
+	size_t index = atomic_fetch_add_explicit(&array->reserved, 1, memory_order_relaxed);
+	if (index >= capacity()) {
+		fprintf(stderr, "arrayAdd: array is full\n");
+		return -1;
+	}
+
+	int k;
+	size_t offset;
+	locate(index, &k, &offset);
+	Slot *segment = getSegment(array, k);
+	if (segment == NULL) {
+		fprintf(stderr, "arrayAdd : memory allocation failed\n");
+		return -1;
+	}
+
+	atomic_store_explicit(&segment[offset], data, memory_order_release);
+	return (int)index;
+}
+
+void arrayDisplay(const Array *array, const char *(*display)(const void *)) {
+
+	if (array == NULL || display == NULL) {
+		fprintf(stderr, "arrayDisplay : argument is null.\n");
+		return;
+	}
+
+	system("cls");
+	int count = arrayCount(array);
+	for (int i = 0; i < count; i++) {
+		void *data = arrayGet(array, i);
+		if (data != NULL)
+			printf("[%s]", display(data));
+		else
+			printf("[%2c]", ' ');
+	}
+	getchar();
+}
+
+// Number of reserved slots. The newest ones may not be published yet.
+int arrayCount(const Array *array) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayCount: argument is null\n");
+		return -1;
+	}
+
+	size_t reserved = atomic_load_explicit(&array->reserved, memory_order_relaxed);
+	return (int)((reserved < capacity()) ? reserved : capacity());
+}
+
+void *arrayGet(const Array *array, int index) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayGet: argument is null\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arrayGet: out of index\n");
+		return NULL;
+	}
+
+	int k;
+	size_t offset;
+	locate((size_t)index, &k, &offset);
+	Slot *segment = atomic_load_explicit(&array->segments[k], memory_order_acquire);
+	if (segment == NULL || segment == CLAIMED)
+		return NULL;
+	return atomic_load_explicit(&segment[offset], memory_order_acquire);
+}
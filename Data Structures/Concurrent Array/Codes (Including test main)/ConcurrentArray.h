@@ -0,0 +1,27 @@
+#ifndef _CONCURRENTARRAY_H_
+#define _CONCURRENTARRAY_H_
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct Array Array;  //For data-hiding.
+
+#ifndef INITIAL_SIZE
+#define INITIAL_SIZE	(4)  //user can define the size of the first segment. It must be a power of two.
+#endif
+#define MAX_SEGMENTS (28)  //segment k holds INITIAL_SIZE << k elements.
+
+// Append-only Array that many threads can fill at once.
+// Segments are never moved, so arrayGet() can run during arrayAdd().
+// arrayAdd() reserves a slot with one atomic increment and returns its index.
+// A reserved slot is published when its data is stored; until then arrayGet() returns NULL.
+// If arrayAdd() fails to allocate a segment it returns -1, but its slot stays
+// reserved : arrayCount() still counts it and arrayGet() returns NULL for it.
+Array *arrayCreate();
+void arrayDestroy(Array *array);
+int arrayAdd(Array *array, void *data);
+void arrayDisplay(const Array *array, const char *(*display)(const void *));
+int arrayCount(const Array *array);
+void *arrayGet(const Array *array, int index);
+
+#endif
@@ -0,0 +1,70 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <time.h>
+#include <threads.h>
+#include "ConcurrentArray.h"
+
+typedef struct {
+	char name[32];
+	int age;
+} Person;
+
+const char *toPerson(const void *data) {
+	static char buf[32];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+// Producers append the same pointer many times; the total is checked at the end.
+#define APPENDS_PER_THREAD (1000000)
+
+static Array *shared;
+static Person worker = { "W", 1 };
+
+int producer(void *arg) {
+	(void)arg;
+	for (int i = 0; i < APPENDS_PER_THREAD; i++)
+		arrayAdd(shared, &worker);
+	return 0;
+}
+
+static double now(void) {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main() {
+	Array *arr = arrayCreate();
+	Person people[5] = {
+		{"A", 11}, {"B", 22}, {"C", 33}, {"D", 44}, {"E", 55} };
+
+	for (int i = 0; i < 5; i++) {
+		arrayAdd(arr, people + i);
+		arrayDisplay(arr, toPerson);
+	}
+	arrayDestroy(arr);
+
+	for (int threads = 1; threads <= 8; threads *= 2) {
+		shared = arrayCreate();
+
+		thrd_t tids[8];
+		double start = now();
+		for (int i = 0; i < threads; i++)
+			thrd_create(&tids[i], producer, NULL);
+		for (int i = 0; i < threads; i++)
+			thrd_join(tids[i], NULL);
+		double elapsed = now() - start;
+
+		int missing = 0;
+		for (int i = 0; i < arrayCount(shared); i++) {
+			if (arrayGet(shared, i) != &worker)
+				missing++;
+		}
+		printf("%d producer(s) : %d elements, %d missing, %.2f Mappends/s\n", threads,
+			arrayCount(shared), missing, threads * (double)APPENDS_PER_THREAD / elapsed / 1e6);
+		arrayDestroy(shared);
+	}
+	return 0;
+}
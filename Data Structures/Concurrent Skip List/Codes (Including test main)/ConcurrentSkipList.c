@@ -0,0 +1,452 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <threads.h>
+#include "ConcurrentSkipList.h"
+
+#define RETIRE_THRESHOLD (16)
+
+typedef struct Node {
+	void *data;
+	int topLevel;
+	atomic_bool marked;  // logically removed.
+	atomic_bool fullyLinked;  // linked at every level.
+	atomic_flag lock;
+	struct Node *retiredNext;
+	_Atomic(struct Node *) next[];
+}Node;
+
+// Epoch based reclamation : a removed node is freed only after every thread
+// that could have seen it has left its operation.
+// A slot fills whole cache lines, so threads don't share one.
+// depth counts nested operations, e.g. a skipListForEachRange() callback
+// that calls skipListGet(); only the outermost one enters and leaves.
+typedef struct EpochSlot {
+	_Alignas(64) atomic_uint state;  // (epoch << 1) | active
+	unsigned int localEpoch;
+	int depth;
+	int retiredCount;
+	Node *limbo[3];
+}EpochSlot;
+
+typedef struct SkipList {
+	Node *head;
+	atomic_int count;
+	CompareFunction compareFunction;
+	atomic_uint epoch;
+	EpochSlot slots[MAX_THREADS];
+}SkipList;
+
+static atomic_bool slotInUse[MAX_THREADS];
+static _Thread_local int threadSlot = -1;
+static _Thread_local unsigned int randomState;
+
+static int acquireSlot(void) {
+	if (threadSlot != -1)
+		return threadSlot;
+
+	for (int i = 0; i < MAX_THREADS; i++) {
+		bool expected = false;
+		if (atomic_compare_exchange_strong(&slotInUse[i], &expected, true)) {
+			threadSlot = i;
+			randomState = 2463534242u ^ (unsigned int)(i * 2654435761u);
+			return i;
+		}
+	}
+	fprintf(stderr, "acquireSlot : too many threads.\n");
+	return -1;
+}
+
+void skipListThreadExit(void) {
+	if (threadSlot == -1)
+		return;
+	atomic_store(&slotInUse[threadSlot], false);
+	threadSlot = -1;
+}
+
+static void freeLimbo(Node **limbo) {
+	Node *node = *limbo;
+	while (node != NULL) {
+		Node *next = node->retiredNext;
+		free(node);
+		node = next;
+	}
+	*limbo = NULL;
+}
+
+// Nodes retired two epochs ago can no longer be reached by anyone.
+static void collect(EpochSlot *slot, unsigned int epoch) {
+	if (slot->localEpoch == epoch)
+		return;
+	freeLimbo(&slot->limbo[(epoch + 1) % 3]);
+	slot->localEpoch = epoch;
+}
+
+static EpochSlot *enterEpoch(SkipList *list) {
+	int index = acquireSlot();
+	if (index == -1)
+		return NULL;
+
+	EpochSlot *slot = &list->slots[index];
+	if ((slot->depth)++ > 0)
+		return slot;
+
+	unsigned int epoch = atomic_load(&list->epoch);
+	atomic_store(&slot->state, (epoch << 1) | 1u);
+	collect(slot, epoch);
+	return slot;
+}
+
+static void exitEpoch(EpochSlot *slot) {
+	if (--(slot->depth) > 0)
+		return;
+	atomic_store_explicit(&slot->state, 0u, memory_order_release);
+}
+
+// SkipList is over-aligned because of its slots, which calloc doesn't promise.
+static SkipList *allocList(void) {
+#ifdef _MSC_VER
+	SkipList *list = _aligned_malloc(sizeof(SkipList), _Alignof(SkipList));
+#else
+	SkipList *list = aligned_alloc(_Alignof(SkipList), sizeof(SkipList));
+#endif
+	if (list != NULL)
+		memset(list, 0, sizeof(SkipList));
+	return list;
+}
+
+static void freeList(SkipList *list) {
+#ifdef _MSC_VER
+	_aligned_free(list);
+#else
+	free(list);
+#endif
+}
+
+static void tryAdvanceEpoch(SkipList *list) {
+	unsigned int epoch = atomic_load(&list->epoch);
+	for (int i = 0; i < MAX_THREADS; i++) {
+		unsigned int state = atomic_load(&list->slots[i].state);
+		if ((state & 1u) && (state >> 1) != epoch)
+			return;
+	}
+	atomic_compare_exchange_strong(&list->epoch, &epoch, epoch + 1);
+}
+
+static void retire(SkipList *list, EpochSlot *slot, Node *node) {
+	unsigned int epoch = atomic_load(&list->epoch);
+	collect(slot, epoch);
+	node->retiredNext = slot->limbo[epoch % 3];
+	slot->limbo[epoch % 3] = node;
+
+	if (++(slot->retiredCount) >= RETIRE_THRESHOLD) {
+		slot->retiredCount = 0;
+		tryAdvanceEpoch(list);
+	}
+}
+
+static void lockNode(Node *node) {
+	while (atomic_flag_test_and_set_explicit(&node->lock, memory_order_acquire))
+		thrd_yield();
+}
+
+static void unlockNode(Node *node) {
+	atomic_flag_clear_explicit(&node->lock, memory_order_release);
+}
+
+static void unlockPreds(Node **preds, int highestLocked) {
+	Node *prevPred = NULL;
+	for (int level = 0; level <= highestLocked; level++) {
+		if (preds[level] != prevPred)
+			unlockNode(preds[level]);
+		prevPred = preds[level];
+	}
+}
+
+// Each level is kept with probability 1/4.
+static int randomLevel(void) {
+	unsigned int x = randomState;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	randomState = x;
+
+	int level = 1;
+	while (level < MAX_LEVEL && (x & 3u) == 0) {
+		level++;
+		x >>= 2;
+	}
+	return level;
+}
+
+static Node *createNode(void *data, int topLevel) {
+	Node *node = calloc(1, sizeof(Node) + sizeof(_Atomic(Node *)) * topLevel);
+	if (node == NULL) {
+		fprintf(stderr, "createNode : calloc failed.\n");
+		return NULL;
+	}
+	node->data = data;
+	node->topLevel = topLevel;
+	atomic_flag_clear(&node->lock);
+	return node;
+}
+
+// Fills preds/succs on every level and returns the highest level
+// where key was found, or -1.
+static int findNode(SkipList *list, void *key, Node **preds, Node **succs) {
+	int foundLevel = -1;
+	Node *pred = list->head;
+	for (int level = MAX_LEVEL - 1; level >= 0; level--) {
+		Node *cur = atomic_load(&pred->next[level]);
+		while (cur != NULL && list->compareFunction(key, cur->data) > 0) {
+			pred = cur;
+			cur = atomic_load(&pred->next[level]);
+		}
+		if (foundLevel == -1 && cur != NULL && list->compareFunction(key, cur->data) == 0)
+			foundLevel = level;
+		preds[level] = pred;
+		succs[level] = cur;
+	}
+	return foundLevel;
+}
+
+SkipList *skipListCreate(CompareFunction compareFunction) {
+	if (compareFunction == NULL) {
+		fprintf(stderr, "skipListCreate : argument is NULL.\n");
+		return NULL;
+	}
+
+	SkipList *list = allocList();
+	if (list == NULL) {
+		fprintf(stderr, "skipListCreate : malloc failed.\n");
+		return NULL;
+	}
+
+	list->head = createNode(NULL, MAX_LEVEL);
+	if (list->head == NULL) {
+		freeList(list);
+		return NULL;
+	}
+	atomic_store(&list->head->fullyLinked, true);
+	list->compareFunction = compareFunction;
+	return list;
+}
+
+void skipListDestroy(SkipList *list) {
+	if (list == NULL)
+		return;
+
+	Node *node = list->head;
+	while (node != NULL) {
+		Node *next = atomic_load(&node->next[0]);
+		free(node);
+		node = next;
+	}
+	for (int i = 0; i < MAX_THREADS; i++) {
+		for (int j = 0; j < 3; j++)
+			freeLimbo(&list->slots[i].limbo[j]);
+	}
+	freeList(list);
+}
+
+int skipListInsert(SkipList *list, void *data) {
+	if (list == NULL || data == NULL) {
+		fprintf(stderr, "skipListInsert : argument is NULL.\n");
+		return -1;
+	}
+
+	EpochSlot *slot = enterEpoch(list);
+	if (slot == NULL)
+		return -1;
+
+	Node *preds[MAX_LEVEL];
+	Node *succs[MAX_LEVEL];
+	int topLevel = randomLevel();
+	while (1) {
+		int foundLevel = findNode(list, data, preds, succs);
+		if (foundLevel != -1) {
+			Node *found = succs[foundLevel];
+			if (!atomic_load(&found->marked)) {
+				while (!atomic_load(&found->fullyLinked))
+					thrd_yield();
+				exitEpoch(slot);
+				return -1;
+			}
+			// Someone is removing the same key. Wait until it is unlinked.
+			continue;
+		}
+
+		int highestLocked = -1;
+		int valid = 1;
+		Node *prevPred = NULL;
+		for (int level = 0; valid && level < topLevel; level++) {
+			Node *pred = preds[level];
+			Node *succ = succs[level];
+			if (pred != prevPred) {
+				lockNode(pred);
+				highestLocked = level;
+				prevPred = pred;
+			}
+			valid = !atomic_load(&pred->marked) &&
+				(succ == NULL || !atomic_load(&succ->marked)) &&
+				atomic_load(&pred->next[level]) == succ;
+		}
+		if (!valid) {
+			unlockPreds(preds, highestLocked);
+			continue;
+		}
+
+		Node *node = createNode(data, topLevel);
+		if (node == NULL) {
+			unlockPreds(preds, highestLocked);
+			exitEpoch(slot);
+			return -1;
+		}
+		for (int level = 0; level < topLevel; level++)
+			atomic_store(&node->next[level], succs[level]);
+		for (int level = 0; level < topLevel; level++)
+			atomic_store(&preds[level]->next[level], node);
+		atomic_store(&node->fullyLinked, true);
+		unlockPreds(preds, highestLocked);
+		atomic_fetch_add(&list->count, 1);
+		exitEpoch(slot);
+		return 0;
+	}
+}
+
+void *skipListGet(SkipList *list, void *key) {
+	if (list == NULL || key == NULL) {
+		fprintf(stderr, "skipListGet : argument is NULL.\n");
+		return NULL;
+	}
+
+	EpochSlot *slot = enterEpoch(list);
+	if (slot == NULL)
+		return NULL;
+
+	Node *preds[MAX_LEVEL];
+	Node *succs[MAX_LEVEL];
+	void *outData = NULL;
+	int foundLevel = findNode(list, key, preds, succs);
+	if (foundLevel != -1) {
+		Node *found = succs[foundLevel];
+		if (atomic_load(&found->fullyLinked) && !atomic_load(&found->marked))
+			outData = found->data;
+	}
+	exitEpoch(slot);
+	return outData;
+}
+
+static int canRemove(Node *node, int foundLevel) {
+	return atomic_load(&node->fullyLinked) &&
+		node->topLevel - 1 == foundLevel &&
+		!atomic_load(&node->marked);
+}
+
+void *skipListRemove(SkipList *list, void *key) {
+	if (list == NULL || key == NULL) {
+		fprintf(stderr, "skipListRemove : argument is NULL.\n");
+		return NULL;
+	}
+
+	EpochSlot *slot = enterEpoch(list);
+	if (slot == NULL)
+		return NULL;
+
+	Node *preds[MAX_LEVEL];
+	Node *succs[MAX_LEVEL];
+	Node *victim = NULL;
+	int isMarked = 0;
+	while (1) {
+		int foundLevel = findNode(list, key, preds, succs);
+		if (!isMarked && (foundLevel == -1 || !canRemove(succs[foundLevel], foundLevel))) {
+			exitEpoch(slot);
+			return NULL;
+		}
+
+		if (!isMarked) {
+			victim = succs[foundLevel];
+			lockNode(victim);
+			if (atomic_load(&victim->marked)) {
+				unlockNode(victim);
+				exitEpoch(slot);
+				return NULL;
+			}
+			atomic_store(&victim->marked, true);
+			isMarked = 1;
+		}
+
+		int highestLocked = -1;
+		int valid = 1;
+		Node *prevPred = NULL;
+		for (int level = 0; valid && level < victim->topLevel; level++) {
+			Node *pred = preds[level];
+			if (pred != prevPred) {
+				lockNode(pred);
+				highestLocked = level;
+				prevPred = pred;
+			}
+			valid = !atomic_load(&pred->marked) && atomic_load(&pred->next[level]) == victim;
+		}
+		if (!valid) {
+			unlockPreds(preds, highestLocked);
+			continue;
+		}
+
+		for (int level = victim->topLevel - 1; level >= 0; level--)
+			atomic_store(&preds[level]->next[level], atomic_load(&victim->next[level]));
+		unlockNode(victim);
+		unlockPreds(preds, highestLocked);
+
+		void *outData = victim->data;
+		atomic_fetch_sub(&list->count, 1);
+		retire(list, slot, victim);
+		exitEpoch(slot);
+		return outData;
+	}
+}
+
+int skipListCount(const SkipList *list) {
+	if (list == NULL) {
+		fprintf(stderr, "skipListCount : argument is NULL.\n");
+		return -1;
+	}
+	return atomic_load(&list->count);
+}
+
+// Visits datas in [from, to] in order. NULL bounds mean the start and end of the list.
+// Concurrent updates may or may not be seen, but every visited data was in the list.
+int skipListForEachRange(SkipList *list, void *from, void *to, int (*userFunc)(void *)) {
+	if (list == NULL || userFunc == NULL) {
+		fprintf(stderr, "skipListForEachRange : argument is NULL.\n");
+		return -1;
+	}
+
+	EpochSlot *slot = enterEpoch(list);
+	if (slot == NULL)
+		return -1;
+
+	Node *cur;
+	if (from == NULL) {
+		cur = atomic_load(&list->head->next[0]);
+	}
+	else {
+		Node *preds[MAX_LEVEL];
+		Node *succs[MAX_LEVEL];
+		findNode(list, from, preds, succs);
+		cur = succs[0];
+	}
+
+	for (; cur != NULL; cur = atomic_load(&cur->next[0])) {
+		if (to != NULL && list->compareFunction(cur->data, to) > 0)
+			break;
+		if (!atomic_load(&cur->fullyLinked) || atomic_load(&cur->marked))
+			continue;
+		if (userFunc(cur->data) == 0)
+			break;
+	}
+	exitEpoch(slot);
+	return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef _CONCURRENTSKIPLIST_H_
+#define _CONCURRENTSKIPLIST_H_
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_LEVEL (16)  //user can define the max level of the skip list.
+#define MAX_THREADS (64)  //user can define the max number of threads using a list at once.
+
+typedef struct Node Node;
+typedef struct SkipList SkipList;
+typedef int (*CompareFunction)(void *data1, void *data2);
+
+// Every function can be called from many threads at once, except
+// skipListCreate() and skipListDestroy().
+// Lookups never take a lock, and writers only lock the nodes they relink.
+// The skipListForEachRange() callback may call the other functions on any list.
+SkipList *skipListCreate(CompareFunction compareFunction);
+void skipListDestroy(SkipList *list);
+int skipListInsert(SkipList *list, void *data);
+void *skipListGet(SkipList *list, void *key);
+void *skipListRemove(SkipList *list, void *key);
+int skipListCount(const SkipList *list);
+int skipListForEachRange(SkipList *list, void *from, void *to, int (*userFunc)(void *));
+
+// A thread that stops using skip lists should call this to give its slot back.
+void skipListThreadExit(void);
+
+#endif
@@ -0,0 +1,180 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <threads.h>
+#include "ConcurrentSkipList.h"
+
+typedef struct Person {
+	char name[32];
+	int age;
+}Person;
+
+const char *toPerson(const void *data) {
+	static char buf[32];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+int comparePerson(void *data1, void *data2) {
+	const Person *p1 = data1;
+	const Person *p2 = data2;
+	return (p1->age - p2->age);
+}
+
+int printPerson(void *data) {
+	printf("%s ", toPerson(data));
+	return 1;
+}
+
+// Throughput test : 90% skipListGet, 10% skipListInsert / skipListRemove.
+#define KEY_RANGE (1 << 16)
+#define OPS_PER_THREAD (1000000)
+
+static int keys[KEY_RANGE];
+static SkipList *shared;
+
+int compareInt(void *data1, void *data2) {
+	int a = *(const int *)data1;
+	int b = *(const int *)data2;
+	return (a > b) - (a < b);
+}
+
+int worker(void *arg) {
+	unsigned int seed = (unsigned int)(size_t)arg * 7919u + 1u;
+	for (int i = 0; i < OPS_PER_THREAD; i++) {
+		seed = seed * 1103515245u + 12345u;
+		int *key = keys + ((seed >> 8) % KEY_RANGE);
+		int op = (seed >> 4) % 20;
+		if (op == 0)
+			skipListInsert(shared, key);
+		else if (op == 1)
+			skipListRemove(shared, key);
+		else
+			skipListGet(shared, key);
+	}
+	skipListThreadExit();
+	return 0;
+}
+
+// Nested test : the skipListForEachRange() callback changes the list it walks
+// while other threads insert and remove. The walk must stay safe after the
+// nested calls leave their epochs.
+#define NESTED_KEYS (4096)
+#define NESTED_WALKS (100)
+
+int changeDuringWalk(void *data) {
+	int key = *(const int *)data;
+	skipListRemove(shared, keys + (key * 7 + 1) % NESTED_KEYS);
+	skipListInsert(shared, keys + (key * 13 + 5) % NESTED_KEYS);
+	skipListGet(shared, keys + key);
+	return 1;
+}
+
+int walker(void *arg) {
+	(void)arg;
+	for (int i = 0; i < NESTED_WALKS; i++)
+		skipListForEachRange(shared, NULL, NULL, changeDuringWalk);
+	skipListThreadExit();
+	return 0;
+}
+
+int churner(void *arg) {
+	unsigned int seed = (unsigned int)(size_t)arg * 7919u + 1u;
+	for (int i = 0; i < OPS_PER_THREAD; i++) {
+		seed = seed * 1103515245u + 12345u;
+		int *key = keys + ((seed >> 8) % NESTED_KEYS);
+		if (seed >> 31)
+			skipListInsert(shared, key);
+		else
+			skipListRemove(shared, key);
+	}
+	skipListThreadExit();
+	return 0;
+}
+
+static double now(void) {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main() {
+
+	// This test code uses Person's age as the key.
+
+	SkipList *list = skipListCreate(comparePerson);
+
+	Person people[8] = { {"FOUR", 40}, {"TWO", 20}, {"ONE", 10}, {"THREE", 30}, {"SIX",60}, {"FIVE", 50}, {"SEVEN", 70}, {"EIGHT", 80} };
+	for (int i = 0; i < 8; i++) {
+		skipListInsert(list, people + i);
+	}
+
+	printf("========skipListForEachRange() test========\n\n");
+	skipListForEachRange(list, NULL, NULL, printPerson);
+	printf("\n");
+	Person from = { "FROM", 25 };
+	Person to = { "TO", 60 };
+	skipListForEachRange(list, &from, &to, printPerson);
+	printf("\n\n");
+
+	printf("========skipListGet() test========\n\n");
+	for (int i = 0; i < 8; i++) {
+		void *data = skipListGet(list, people + i);
+		if (data != NULL)
+			printf("%s\n", toPerson(data));
+	}
+
+	printf("========skipListRemove() test========\n\n");
+	Person *p = skipListRemove(list, &people[2]);
+	printf("Removed data : %s\n", toPerson(p));
+	if (skipListRemove(list, &people[2]) == NULL)
+		printf("skipListRemove failed.\n");
+	skipListForEachRange(list, NULL, NULL, printPerson);
+	printf("\ncount : %d\n\n", skipListCount(list));
+	skipListDestroy(list);
+
+	printf("========throughput test (90%% read)========\n\n");
+	for (int i = 0; i < KEY_RANGE; i++)
+		keys[i] = i;
+
+	for (int threads = 1; threads <= 8; threads *= 2) {
+		shared = skipListCreate(compareInt);
+		for (int i = 0; i < KEY_RANGE; i += 2)
+			skipListInsert(shared, keys + i);
+
+		thrd_t tids[8];
+		double start = now();
+		for (int i = 0; i < threads; i++)
+			thrd_create(&tids[i], worker, (void *)(size_t)i);
+		for (int i = 0; i < threads; i++)
+			thrd_join(tids[i], NULL);
+		double elapsed = now() - start;
+
+		printf("%d thread(s) : %.2f Mops/s\n", threads, threads * (double)OPS_PER_THREAD / elapsed / 1e6);
+		skipListDestroy(shared);
+	}
+
+	printf("\n========nested calls test========\n\n");
+	shared = skipListCreate(compareInt);
+	for (int i = 0; i < NESTED_KEYS; i += 2)
+		skipListInsert(shared, keys + i);
+
+	thrd_t tids[4];
+	thrd_create(&tids[0], walker, NULL);
+	thrd_create(&tids[1], walker, NULL);
+	thrd_create(&tids[2], churner, (void *)(size_t)1);
+	thrd_create(&tids[3], churner, (void *)(size_t)2);
+	for (int i = 0; i < 4; i++)
+		thrd_join(tids[i], NULL);
+
+	int found = 0;
+	for (int i = 0; i < NESTED_KEYS; i++)
+		found += (skipListGet(shared, keys + i) != NULL);
+	printf("count : %d, found : %d%s\n", skipListCount(shared), found,
+		(found == skipListCount(shared)) ? "" : " (lost nodes!)");
+	skipListDestroy(shared);
+	skipListThreadExit();
+	return 0;
+}
@@ -1,5 +1,6 @@
 #ifndef _DOUBLYCIRCULARLINKEDLIST_H_
 #define _DOUBLYCIRCULARLINKEDLIST_H_
+#include <stddef.h>
 
 #define list_entry(ptr, type, member)   \
     (type*)((char*)ptr - (long)&((type*)0)->member)
@@ -26,19 +27,103 @@ inline static void insertNode(Node * newNode, Node * prev, Node * next) {
     next->prev = newNode;
 }
 
-inline void listAdd(Node * head, Node * node) {
+inline static void listAdd(Node * head, Node * node) {
     insertNode(node, head->prev, head);
 }
 
-inline void listAddHead(Node *head, Node *node) {
+inline static void listAddHead(Node *head, Node *node) {
     insertNode(node, head, head->next);
 }
 
-inline void listRemove(Node *node) {
+inline static void listRemove(Node *node) {
 
     Node *prev = node->prev;
     Node *next = node->next;
     prev->next = next;
     next->prev = prev;
 }
+
+// compare receives two nodes; use list_entry() to reach the entries.
+// listSort() is a stable bottom-up merge sort. It only relinks nodes,
+// so it allocates nothing and uses no recursion.
+typedef int (*ListCompareFunction)(const Node *node1, const Node *node2);
+
+// Stable merge of two NULL-terminated chains, linked after tail.
+// Returns the last node of the result.
+inline static Node *list_merge_chains(Node *left, Node *right, Node *tail, ListCompareFunction compare) {
+    while (left != NULL && right != NULL) {
+        if (compare(right, left) < 0) {
+            tail->next = right;
+            right = right->next;
+        }
+        else {
+            tail->next = left;
+            left = left->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (left != NULL) ? left : right;
+    while (tail->next != NULL)
+        tail = tail->next;
+    return tail;
+}
+
+// Cuts the chain after n nodes and returns the rest.
+inline static Node *list_split_chain(Node *node, int n) {
+    for (int i = 1; node != NULL && i < n; i++)
+        node = node->next;
+    if (node == NULL)
+        return NULL;
+    Node *rest = node->next;
+    node->next = NULL;
+    return rest;
+}
+
+// The sort only follows next; this puts prev back and closes the circle.
+inline static void list_relink_prev(Node *head) {
+    Node *prev = head;
+    for (Node *node = head->next; node != NULL; node = node->next) {
+        node->prev = prev;
+        prev = node;
+    }
+    prev->next = head;
+    head->prev = prev;
+}
+
+// Merges runs of width 1, 2, 4, ... until a pass finds a single run.
+inline static void listSort(Node *head, ListCompareFunction compare) {
+    if (head->next == head)
+        return;
+
+    head->prev->next = NULL;
+    for (int width = 1; ; width *= 2) {
+        Node *tail = head;
+        Node *cur = head->next;
+        int runs = 0;
+        while (cur != NULL) {
+            Node *left = cur;
+            Node *right = list_split_chain(left, width);
+            cur = list_split_chain(right, width);
+            tail = list_merge_chains(left, right, tail, compare);
+            runs++;
+        }
+        if (runs == 1)
+            break;
+    }
+    list_relink_prev(head);
+}
+
+// Moves every node of the sorted list other into the sorted list head.
+// Equal nodes of head come first. other is left empty.
+inline static void listMerge(Node *head, Node *other, ListCompareFunction compare) {
+    if (other->next == other)
+        return;
+
+    head->prev->next = NULL;
+    other->prev->next = NULL;
+    list_merge_chains(head->next, other->next, head, compare);
+    list_relink_prev(head);
+    other->next = other;
+    other->prev = other;
+}
 #endif
\ No newline at end of file
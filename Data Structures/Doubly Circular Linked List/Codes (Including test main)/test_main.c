@@ -44,6 +44,12 @@ void displayBackwardly(const Node *head) {
     getchar();
 }
 
+int compareAge(const Node *node1, const Node *node2) {
+    const Person *p1 = list_entry(node1, Person, list);
+    const Person *p2 = list_entry(node2, Person, list);
+    return (p1->age - p2->age);
+}
+
 int main(void) {
     Person people[4] = {
         {"eddy", 20}, { "pororo", 30}, { "petty", 40}, { "poby", 50}
@@ -65,5 +71,18 @@ int main(void) {
     }
 
     display(&head);
+
+    // Sorting relinks the nodes; merging moves the other list's nodes in.
+    Person more[3] = { {"crong", 45}, {"loopy", 10}, {"harry", 25} };
+    LIST_HEAD(others);
+    for (int i = 0; i < 3; i++) {
+        listAddHead(&others, &(more + i)->list);
+    }
+    listSort(&others, compareAge);
+    display(&others);
+
+    listMerge(&head, &others, compareAge);
+    display(&head);
+    displayBackwardly(&head);
     return 0;
 }
\ No newline at end of file
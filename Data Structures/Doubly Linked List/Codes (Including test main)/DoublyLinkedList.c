@@ -214,7 +214,7 @@ void *listRemoveHead(List *list) {
 
 	Node *delNode = list->head->next;
 	list->head->next = delNode->next;
-	delNode->next->prev = list->head->next;
+	delNode->next->prev = list->head;
 	void *outData = delNode->data;
 	free(delNode);
 	--(list->count);
@@ -310,7 +310,7 @@ int listInsert(List *list, int index, void *data) {
 
 	node->data = data;
 
-	Node *prev = getNodeAtIndex(list, index - 1);
+	Node *prev = getNodeAtIndex(list, index)->prev;
 	node->next = prev->next;
 	node->prev = prev;
 	prev->next->prev = node;
@@ -319,4 +319,241 @@ int listInsert(List *list, int index, void *data) {
 	++(list->count);
 
 	return 0;
-}
\ No newline at end of file
+}
+
+// Stable merge of two NULL-terminated chains, linked after tail.
+// Returns the last node of the result.
+static Node *mergeChains(Node *left, Node *right, Node *tail, CompareFunction compare) {
+	while (left != NULL && right != NULL) {
+		if (compare(right->data, left->data) < 0) {
+			tail->next = right;
+			right = right->next;
+		}
+		else {
+			tail->next = left;
+			left = left->next;
+		}
+		tail = tail->next;
+	}
+	tail->next = (left != NULL) ? left : right;
+	while (tail->next != NULL)
+		tail = tail->next;
+	return tail;
+}
+
+// Cuts the chain after n nodes and returns the rest.
+static Node *splitChain(Node *node, int n) {
+	for (int i = 1; node != NULL && i < n; i++)
+		node = node->next;
+	if (node == NULL)
+		return NULL;
+	Node *rest = node->next;
+	node->next = NULL;
+	return rest;
+}
+
+// Merges runs of width 1, 2, 4, ... until one run is left.
+static Node *sortChain(Node *head, int count, CompareFunction compare) {
+	Node *tail = head;
+	for (int width = 1; width < count; width *= 2) {
+		tail = head;
+		Node *cur = head->next;
+		while (cur != NULL) {
+			Node *left = cur;
+			Node *right = splitChain(left, width);
+			cur = splitChain(right, width);
+			tail = mergeChains(left, right, tail, compare);
+		}
+	}
+	return tail;
+}
+
+// The sort only follows next; this puts prev back.
+static void relinkPrev(List *list, Node *last) {
+	Node *prev = list->head;
+	for (Node *node = list->head->next; node != NULL; node = node->next) {
+		node->prev = prev;
+		prev = node;
+	}
+	last->next = list->tail;
+	list->tail->prev = last;
+}
+
+int listSort(List *list, CompareFunction compare) {
+	if (list == NULL || compare == NULL) {
+		fprintf(stderr, "listSort:argument is NULL.\n");
+		return -1;
+	}
+
+	if (list->count < 2)
+		return 0;
+
+	list->tail->prev->next = NULL;
+	relinkPrev(list, sortChain(list->head, list->count, compare));
+	return 0;
+}
+
+int listMerge(List *list, List *other, CompareFunction compare) {
+	if (list == NULL || other == NULL || compare == NULL) {
+		fprintf(stderr, "listMerge:argument is NULL.\n");
+		return -1;
+	}
+
+	if (list == other) {
+		fprintf(stderr, "listMerge:lists are the same.\n");
+		return -1;
+	}
+
+	if (other->count == 0)
+		return 0;
+
+	list->tail->prev->next = NULL;
+	other->tail->prev->next = NULL;
+	relinkPrev(list, mergeChains(list->head->next, other->head->next, list->head, compare));
+	list->count += other->count;
+
+	other->head->next = other->tail;
+	other->tail->prev = other->head;
+	other->count = 0;
+	return 0;
+}
+
+Node *listFirst(const List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listFirst:list is NULL.\n");
+		return NULL;
+	}
+	return (list->count > 0) ? list->head->next : NULL;
+}
+
+Node *listLast(const List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listLast:list is NULL.\n");
+		return NULL;
+	}
+	return (list->count > 0) ? list->tail->prev : NULL;
+}
+
+Node *listNextNode(const List *list, const Node *node) {
+	if (list == NULL || node == NULL) {
+		fprintf(stderr, "listNextNode:argument is NULL.\n");
+		return NULL;
+	}
+	return (node->next != list->tail) ? node->next : NULL;
+}
+
+Node *listPrevNode(const List *list, const Node *node) {
+	if (list == NULL || node == NULL) {
+		fprintf(stderr, "listPrevNode:argument is NULL.\n");
+		return NULL;
+	}
+	return (node->prev != list->head) ? node->prev : NULL;
+}
+
+Node *listNodeAt(const List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listNodeAt:list is NULL.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listNodeAt:index is out of bound.\n");
+		return NULL;
+	}
+	return getNodeAtIndex(list, index);
+}
+
+void *listNodeData(const Node *node) {
+	if (node == NULL) {
+		fprintf(stderr, "listNodeData:node is NULL.\n");
+		return NULL;
+	}
+	return node->data;
+}
+
+// Links the chain first..last in front of position.
+static void linkBefore(Node *position, Node *first, Node *last) {
+	Node *prev = position->prev;
+	prev->next = first;
+	first->prev = prev;
+	last->next = position;
+	position->prev = last;
+}
+
+int listConcat(List *list, List *other) {
+	if (list == NULL || other == NULL) {
+		fprintf(stderr, "listConcat:argument is NULL.\n");
+		return -1;
+	}
+
+	if (list == other) {
+		fprintf(stderr, "listConcat:lists are the same.\n");
+		return -1;
+	}
+
+	if (other->count == 0)
+		return 0;
+
+	linkBefore(list->tail, other->head->next, other->tail->prev);
+	list->count += other->count;
+
+	other->head->next = other->tail;
+	other->tail->prev = other->head;
+	other->count = 0;
+	return 0;
+}
+
+int listSplice(List *list, Node *position, List *other, Node *first, Node *last, int count) {
+	if (list == NULL || other == NULL || first == NULL || last == NULL) {
+		fprintf(stderr, "listSplice:argument is NULL.\n");
+		return -1;
+	}
+
+	if (count <= 0 || count > other->count) {
+		fprintf(stderr, "listSplice:count is out of bound.\n");
+		return -1;
+	}
+
+	if (position == NULL)
+		position = list->tail;
+
+	if (position == first || position == last->next)
+		return 0;
+
+	first->prev->next = last->next;
+	last->next->prev = first->prev;
+	linkBefore(position, first, last);
+
+	other->count -= count;
+	list->count += count;
+	return 0;
+}
+
+List *listSplitAt(List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listSplitAt:list is NULL.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index > list->count) {
+		fprintf(stderr, "listSplitAt:index is out of bound.\n");
+		return NULL;
+	}
+
+	List *rest = listInitialize(list->freeFunction);
+	if (rest == NULL)
+		return NULL;
+
+	if (index == list->count)
+		return rest;
+
+	Node *first = getNodeAtIndex(list, index);
+	Node *last = list->tail->prev;
+	first->prev->next = list->tail;
+	list->tail->prev = first->prev;
+	linkBefore(rest->tail, first, last);
+
+	rest->count = list->count - index;
+	list->count = index;
+	return rest;
+}
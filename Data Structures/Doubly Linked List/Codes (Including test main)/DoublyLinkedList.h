@@ -18,4 +18,34 @@ void *listGet(const List *list, int index);
 void *listSet(List *list, int index, void *newData);
 int listInsert(List *list, int index, void *data);
 
+// Node handles, for walking the list and for the splice functions below.
+// listFirst(), listLast(), listNextNode() and listPrevNode() return NULL past the ends.
+Node *listFirst(const List *list);
+Node *listLast(const List *list);
+Node *listNextNode(const List *list, const Node *node);
+Node *listPrevNode(const List *list, const Node *node);
+Node *listNodeAt(const List *list, int index);
+void *listNodeData(const Node *node);
+
+// These relink whole runs of nodes, so nothing is allocated or freed per element.
+// listConcat() moves every element of other to the back of list in O(1).
+// listSplice() moves the count nodes first..last of other in front of position
+// in list (to the back when position is NULL) in O(1). count must be the
+// length of the run; list and other may be the same list, but then position
+// must not be inside first..last (the result is undefined).
+// listSplitAt() moves the elements from index on into a new list and returns it;
+// only finding the node walks the list.
+int listConcat(List *list, List *other);
+int listSplice(List *list, Node *position, List *other, Node *first, Node *last, int count);
+List *listSplitAt(List *list, int index);
+
+// compare receives the data of two elements. listSort() is a stable bottom-up
+// merge sort that relinks the nodes, so it allocates nothing and uses no recursion.
+// listMerge() moves every element of the sorted list other into the sorted list
+// list, keeping both orders; other is left empty.
+typedef int (*CompareFunction)(const void *data1, const void *data2);
+
+int listSort(List *list, CompareFunction compare);
+int listMerge(List *list, List *other, CompareFunction compare);
+
 #endif
\ No newline at end of file
@@ -16,6 +16,12 @@ const char *toPerson(const void *data) {
 	return (const char *)buf;
 }
 
+int comparePerson(const void *data1, const void *data2) {
+	const Person *p1 = data1;
+	const Person *p2 = data2;
+	return (p1->age - p2->age);
+}
+
 // test code 1 - Node's data using Stack memory.
 int main() {
 
@@ -33,6 +39,30 @@ int main() {
 	listDisplay(list, toPerson);
 	listReverseDisplay(list, toPerson);
 
+	// Sorting relinks the nodes; merging moves the other list's nodes in.
+	List *others = listInitialize(NULL);
+	Person more[3] = { {"F",6},{"G",0},{"H",3} };
+	for (int i = 0; i < 3; i++) {
+		listAddFront(others, more + i);
+	}
+	listSort(others, comparePerson);
+	listDisplay(others, toPerson);
+
+	listMerge(list, others, comparePerson);
+	listDisplay(list, toPerson);
+	listReverseDisplay(list, toPerson);
+	listFinalize(others);
+
+	// Splitting and splicing relink runs of nodes; nothing is copied.
+	List *back = listSplitAt(list, 4);
+	listDisplay(back, toPerson);
+	listSplice(list, listFirst(list), back, listFirst(back), listNextNode(back, listFirst(back)), 2);
+	listDisplay(list, toPerson);
+	listConcat(list, back);
+	listDisplay(list, toPerson);
+	listReverseDisplay(list, toPerson);
+	listFinalize(back);
+
 	listFinalize(list);
 	return 0;
 }
@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GapBufferArray.h"
+
+// contents : [0, gapStart) elements, [gapStart, gapEnd) gap, [gapEnd, size) elements
+typedef struct Array {
+	void **contents;
+	int size;
+	int gapStart;
+	int gapEnd;
+}Array;
+
+static int physicalIndex(const Array *array, int index) {
+	return (index < array->gapStart) ? index : index + (array->gapEnd - array->gapStart);
+}
+
+Array *arrayCreate() {
+	Array *array = calloc(1, sizeof(Array));
+	if (array == NULL) {
+		perror("arrayCreate");
+		return NULL;
+	}
+	return array;
+}
+
+void arrayDestroy(Array *array) {
+	if (array == NULL)
+		return;
+	free(array->contents);
+	free(array);
+}
+
+// Grows the buffer and widens the gap. The elements after the gap move to the end.
+static int increaseSize(Array *array, int size) {
+	if (array == NULL) {
+		fprintf(stderr, "increaseSize : argument is null.\n");
+		return -1;
+	}
+
+	if (size <= 0) {
+		fprintf(stderr, "increaseSize : invalid size value.\n");
+		return -1;
+	}
+
+	if (size < array->size) {
+		return 0;
+	}
+
+	if (size > MAX_SIZE) {
+		fprintf(stderr, "increaseSize : size overflow.\n");
+		return -1;
+	}
+
+	int newSize = (array->size == 0) ? INITIAL_SIZE : array->size;
+	while (newSize < size) {
+		newSize *= 2;
+		if (newSize > MAX_SIZE || newSize < size) {
+			newSize = MAX_SIZE;
+		}
+	}
+
+	void **newContents = realloc(array->contents, sizeof(void *) * newSize);
+	if (newContents == NULL) {
+		fprintf(stderr, "increaseSize : realloc failed.\n");
+		return -1;
+	}
+
+	int tail = array->size - array->gapEnd;
+	memmove(newContents + newSize - tail, newContents + array->gapEnd, sizeof(void *) * tail);
+	array->contents = newContents;
+	array->gapEnd = newSize - tail;
+	array->size = newSize;
+	return 0;
+}
+
+static void moveGap(Array *array, int index) {
+	if (index < array->gapStart) {
+		int n = array->gapStart - index;
+		memmove(array->contents + array->gapEnd - n, array->contents + index, sizeof(void *) * n);
+		array->gapStart -= n;
+		array->gapEnd -= n;
+	}
+	else if (index > array->gapStart) {
+		int n = index - array->gapStart;
+		memmove(array->contents + array->gapStart, array->contents + array->gapEnd, sizeof(void *) * n);
+		array->gapStart += n;
+		array->gapEnd += n;
+	}
+}
+
+static int insertAt(Array *array, int index, void *data) {
+	if (array->gapStart == array->gapEnd && increaseSize(array, array->size + 1) == -1)
+		return -1;
+
+	moveGap(array, index);
+	array->contents[array->gapStart++] = data;
+	return 0;
+}
+
+int arrayAdd(Array *array, void *data) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayAdd: argument is null\n");
+		return -1;
+	}
+
+	if (insertAt(array, arrayCount(array), data) == -1) {
+		fprintf(stderr, "arrayAdd : memory allocation failed\n");
+		return -1;
+	}
+	return 0;
+}
+
+void arrayDisplay(const Array *array, const char *(*display)(const void *)) {
+
+	if (array == NULL || display == NULL) {
+		fprintf(stderr, "arrayDisplay : argument is null.\n");
+		return;
+	}
+
+	system("cls");
+	for (int i = 0; i < array->size; i++) {
+		if (i < array->gapStart || i >= array->gapEnd)
+			printf("[%s]", display(array->contents[i]));
+		else
+			printf("[%2c]", ' ');
+	}
+	getchar();
+}
+
+void *arraySet(Array *array, int index, void *newData) {
+	if (array == NULL) {
+		fprintf(stderr, "arraySet: argument is null\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arraySet: out of index\n");
+		return NULL;
+	}
+
+	void **slot = array->contents + physicalIndex(array, index);
+	void *oldData = *slot;
+	*slot = newData;
+	return oldData;
+}
+
+int arrayInsert(Array *array, int index, void *newData) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayInsert: argument is null\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arrayInsert: out of index\n");
+		return -1;
+	}
+
+	if (insertAt(array, index, newData) == -1) {
+		fprintf(stderr, "arrayInsert : memory allocation failed\n");
+		return -1;
+	}
+	return 0;
+}
+
+int arrayCount(const Array *array) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayCount: argument is null\n");
+		return -1;
+	}
+	return array->size - (array->gapEnd - array->gapStart);
+}
+
+void *arrayGet(const Array *array, int index) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayGet: argument is null\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arrayGet: out of index\n");
+		return NULL;
+	}
+	return array->contents[physicalIndex(array, index)];
+}
+
+void *arrayRemove(Array *array, int index) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayRemove: argument is null\n");
+		return NULL;
+	}
+
+	if (arrayCount(array) == 0) {
+		fprintf(stderr, "arrayRemove: array is empty\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arrayRemove: out of index\n");
+		return NULL;
+	}
+
+	// The removed element is absorbed by the gap.
+	moveGap(array, index);
+	return array->contents[array->gapEnd++];
+}
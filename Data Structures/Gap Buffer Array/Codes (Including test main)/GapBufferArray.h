@@ -0,0 +1,30 @@
+#ifndef _GAPBUFFERARRAY_H_
+#define _GAPBUFFERARRAY_H_
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct Array Array;  //For data-hiding.
+
+#ifndef INITIAL_SIZE
+#define INITIAL_SIZE	(4)  //user can define the initial size.
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (4096)  //user can define the max size of the array.
+#endif
+
+// Same API as Array.h, but the free space is a gap kept at the last edit position.
+// arrayInsert()/arrayRemove() only move the elements between the gap and
+// the new position, so repeated edits around one place cost O(1) amortized.
+Array *arrayCreate();
+void arrayDestroy(Array *array);
+int arrayAdd(Array *array, void *data);
+void arrayDisplay(const Array *array, const char *(*display)(const void *));
+void *arraySet(Array *array, int index, void *newData);
+int arrayInsert(Array *array, int index, void *newData);
+int arrayCount(const Array *array);
+void *arrayGet(const Array *array, int index);
+void *arrayRemove(Array *array, int index);
+
+#endif
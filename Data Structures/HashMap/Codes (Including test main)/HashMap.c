@@ -102,26 +102,11 @@ static int equalsKey(void *key1, int hash1, void *key2, int hash2, EqualsFunctio
 	return equalsFunc(key1, key2);
 }
 
-static int extendIfNecessary(Hashmap *map) {
-	if (map == NULL) {
-		fprintf(stderr, "increaseSize : argument is NULL.\n");
-		return -1;
-	}
-
-	if (map->count <= (map->bucketSize * 3 / 4)) {
-		return 0;
-	}
-
-	size_t newBucketSize = map->bucketSize * 2;
-	if (newBucketSize >= MAX_BUCKETSIZE || map->bucketSize == MAX_BUCKETSIZE) {
-		fprintf(stderr, "increaseSize : size overflow.\n");
-		return -1;
-	}
-
+static int rehash(Hashmap *map, size_t newBucketSize) {
 	Node **newBuckets = NULL;
 	newBuckets = calloc(newBucketSize, sizeof(Node *));
 	if (newBuckets == NULL) {
-		fprintf(stderr, "increaseSize : realloc failed.\n");
+		fprintf(stderr, "rehash : calloc failed.\n");
 		return -1;
 	}
 	for (size_t i = 0; i < map->bucketSize; i++) {
@@ -140,6 +125,51 @@ static int extendIfNecessary(Hashmap *map) {
 	map->bucketSize = newBucketSize;
 	return 0;
 }
+
+static int extendIfNecessary(Hashmap *map) {
+	if (map == NULL) {
+		fprintf(stderr, "increaseSize : argument is NULL.\n");
+		return -1;
+	}
+
+	if (map->count <= (map->bucketSize * 3 / 4)) {
+		return 0;
+	}
+
+	size_t newBucketSize = map->bucketSize * 2;
+	if (newBucketSize >= MAX_BUCKETSIZE || map->bucketSize == MAX_BUCKETSIZE) {
+		fprintf(stderr, "increaseSize : size overflow.\n");
+		return -1;
+	}
+	return rehash(map, newBucketSize);
+}
+
+// Halves the buckets below 1/4 load. A halved table is under 1/2 load and
+// grows again only above 3/4, so a put/remove cycle can't rehash every time.
+static void shrinkIfNecessary(Hashmap *map) {
+	if (map->bucketSize <= DEFAULT_BUCKETSIZE || map->count >= map->bucketSize / 4) {
+		return;
+	}
+	rehash(map, map->bucketSize / 2);  // the old buckets are kept if this fails.
+}
+
+// Rehashes into the fewest buckets that hold count at 3/4 load.
+int hashmapCompact(Hashmap *map) {
+	if (map == NULL) {
+		fprintf(stderr, "hashmapCompact : argument is NULL.\n");
+		return -1;
+	}
+
+	size_t newBucketSize = DEFAULT_BUCKETSIZE;
+	while (map->count > newBucketSize * 3 / 4) {
+		newBucketSize *= 2;
+	}
+
+	if (newBucketSize >= map->bucketSize) {
+		return 0;
+	}
+	return rehash(map, newBucketSize);
+}
 void *hashmapPut(Hashmap *map, void *key, void *value) {
 	if (map == NULL || key == NULL || value == NULL) {
 		fprintf(stderr, "hashmapPut : argument is NULL.\n");
@@ -212,6 +242,7 @@ void *hashmapRemove(Hashmap *map, void *key) {
 			*ptr = cur->next;
 			free(cur);
 			--map->count;
+			shrinkIfNecessary(map);
 			return oldValue;
 		}
 		ptr = &(cur->next);
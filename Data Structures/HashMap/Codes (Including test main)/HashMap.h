@@ -17,4 +17,8 @@ void *hashmapRemove(Hashmap *map, void *key);
 void hashmapDisplay(const Hashmap *map, const char *(*displayFunc)(const void *));
 int hashmapForEach(Hashmap *map, int (*userFunc)(void *, void *));
 
+// hashmapRemove() halves the buckets below 1/4 load.
+// hashmapCompact() shrinks them to the smallest size for the current count.
+int hashmapCompact(Hashmap *map);
+
 #endif
\ No newline at end of file
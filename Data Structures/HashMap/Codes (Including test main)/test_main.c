@@ -73,6 +73,13 @@ int main() {
 	hashmapForEach(map, increaseAge);
 	hashmapDisplay(map, toPerson);
 
+	printf("\n\n===shrink test===\n\n");
+	hashmapRemove(map, "BB");
+	hashmapRemove(map, "CCC");
+	hashmapDisplay(map, toPerson);
+	hashmapCompact(map);
+	hashmapDisplay(map, toPerson);
+
 	hashmapDestroy(map);
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,467 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include "IndexableSkipList.h"
+
+
+typedef struct Link {
+	struct Node *next;
+	int width;  // how far next is from this node; a NULL next is at count + 1.
+}Link;
+
+typedef struct Node {
+	void *data;
+	struct Node *prev;  // level 0 only. The first node points to head.
+	int level;
+	Link links[];
+}Node;
+
+// head is position 0 and element i is position i + 1.
+typedef struct List {
+	Node *head;
+	Node *tail;  // last node, or head when the list is empty.
+	int count;
+	unsigned int randomState;
+	FreeFunction *freeFunction;
+}List;
+
+// Each level is kept with probability 1/4.
+static int randomLevel(List *list) {
+	unsigned int x = list->randomState;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	list->randomState = x;
+
+	int level = 1;
+	while (level < MAX_LEVEL && (x & 3u) == 0) {
+		level++;
+		x >>= 2;
+	}
+	return level;
+}
+
+static Node *createNode(void *data, int level) {
+	Node *node = malloc(sizeof(Node) + sizeof(Link) * level);
+	if (node == NULL)
+		return NULL;
+	node->data = data;
+	node->prev = NULL;
+	node->level = level;
+	return node;
+}
+
+static void resetHead(List *list) {
+	for (int level = 0; level < MAX_LEVEL; level++) {
+		list->head->links[level].next = NULL;
+		list->head->links[level].width = 1;
+	}
+	list->tail = list->head;
+	list->count = 0;
+}
+
+static Node *getNodeAtIndex(const List *list, int index) {
+	Node *node = list->head;
+	int position = 0;
+	for (int level = MAX_LEVEL - 1; level >= 0; level--) {
+		while (node->links[level].next != NULL && position + node->links[level].width <= index + 1) {
+			position += node->links[level].width;
+			node = node->links[level].next;
+		}
+	}
+	return node;
+}
+
+// Fills update with the last node before position + 1 on every level,
+// and positions with where those nodes are.
+static void findPath(const List *list, int position, Node **update, int *positions) {
+	Node *node = list->head;
+	int current = 0;
+	for (int level = MAX_LEVEL - 1; level >= 0; level--) {
+		while (node->links[level].next != NULL && current + node->links[level].width <= position) {
+			current += node->links[level].width;
+			node = node->links[level].next;
+		}
+		update[level] = node;
+		positions[level] = current;
+	}
+}
+
+// The new element becomes element index.
+static int insertAt(List *list, int index, void *data) {
+	Node *node = createNode(data, randomLevel(list));
+	if (node == NULL)
+		return -1;
+
+	Node *update[MAX_LEVEL];
+	int positions[MAX_LEVEL];
+	findPath(list, index, update, positions);
+
+	for (int level = 0; level < MAX_LEVEL; level++) {
+		Link *link = &update[level]->links[level];
+		if (level < node->level) {
+			node->links[level].next = link->next;
+			node->links[level].width = positions[level] + link->width - index;
+			link->next = node;
+			link->width = index + 1 - positions[level];
+		}
+		else {
+			++(link->width);
+		}
+	}
+
+	node->prev = update[0];
+	if (node->links[0].next != NULL)
+		node->links[0].next->prev = node;
+	else
+		list->tail = node;
+	++(list->count);
+	return 0;
+}
+
+static void *removeAt(List *list, int index) {
+	Node *update[MAX_LEVEL];
+	int positions[MAX_LEVEL];
+	findPath(list, index, update, positions);
+
+	Node *node = update[0]->links[0].next;
+	for (int level = 0; level < MAX_LEVEL; level++) {
+		Link *link = &update[level]->links[level];
+		if (level < node->level) {
+			link->next = node->links[level].next;
+			link->width += node->links[level].width - 1;
+		}
+		else {
+			--(link->width);
+		}
+	}
+
+	if (node->links[0].next != NULL)
+		node->links[0].next->prev = node->prev;
+	else
+		list->tail = node->prev;
+
+	void *outData = node->data;
+	free(node);
+	--(list->count);
+	return outData;
+}
+
+List *listInitialize(FreeFunction freeFunction) {
+
+	List *list = calloc(1, sizeof(List));
+	if (list == NULL) {
+		fprintf(stderr, "listInitialize:calloc failed.\n");
+		return NULL;
+	}
+
+	list->head = createNode(NULL, MAX_LEVEL);
+	if (list->head == NULL) {
+		fprintf(stderr, "listInitialize:malloc failed.\n");
+		free(list);
+		return NULL;
+	}
+
+	resetHead(list);
+	list->randomState = 2463534242u;
+	list->freeFunction = freeFunction;
+	return list;
+}
+
+int listFinalize(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listFinalize:list is NULL.\n");
+		return -1;
+	}
+
+	Node *node = list->head->links[0].next;
+	while (node != NULL) {
+		Node *next = node->links[0].next;
+		if (list->freeFunction) {
+			list->freeFunction(node->data);
+		}
+		free(node);
+		node = next;
+	}
+	free(list->head);
+	free(list);
+	return 0;
+}
+
+void listDisplay(const List *list, const char *(*displayFunc)(const void *)) {
+	if (list == NULL) {
+		fprintf(stderr, "listDisplay:list is NULL.\n");
+		return;
+	}
+
+	system("cls");
+	printf("[head]");
+	for (Node *node = list->head->links[0].next; node != NULL; node = node->links[0].next)
+		printf("<->[%s]", displayFunc(node->data));
+	printf("<->[tail]");
+	getchar();
+}
+
+void listReverseDisplay(const List *list, const char *(*displayFunc)(const void *)) {
+	if (list == NULL) {
+		fprintf(stderr, "listDisplay:list is NULL.\n");
+		return;
+	}
+
+	system("cls");
+	printf("[tail]");
+	for (Node *node = list->tail; node != list->head; node = node->prev)
+		printf("<->[%s]", displayFunc(node->data));
+	printf("<->[head]");
+	getchar();
+}
+
+int listAddBack(List *list, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listAdd:list is NULL.\n");
+		return -1;
+	}
+
+	if (insertAt(list, list->count, data) == -1) {
+		fprintf(stderr, "listAdd:malloc failed.\n");
+		return -1;
+	}
+	return 0;
+}
+
+int listAddFront(List *list, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listAddFront:list is NULL.\n");
+		return -1;
+	}
+
+	if (insertAt(list, 0, data) == -1) {
+		fprintf(stderr, "listAddFront:malloc failed.\n");
+		return -1;
+	}
+	return 0;
+}
+
+void *listRemove(List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemove:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemove:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listRemove:index is out of bound.\n");
+		return NULL;
+	}
+
+	return removeAt(list, index);
+}
+
+void *listRemoveHead(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemoveHead:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemoveHead:list is empty.\n");
+		return NULL;
+	}
+
+	return removeAt(list, 0);
+}
+
+void *listRemoveTail(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemoveTail:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemoveTail:list is empty.\n");
+		return NULL;
+	}
+
+	return removeAt(list, list->count - 1);
+}
+
+void *listGet(const List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listGet:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listGet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listGet:index is out of bound.\n");
+		return NULL;
+	}
+
+	Node *node = getNodeAtIndex(list, index);
+	return node->data;
+}
+
+void *listSet(List *list, int index, void *newData) {
+	if (list == NULL) {
+		fprintf(stderr, "listSet:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listSet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listSet:index is out of bound.\n");
+		return NULL;
+	}
+
+	Node *node = getNodeAtIndex(list, index);
+	void *oldData = node->data;
+	node->data = newData;
+	return oldData;
+}
+
+int listInsert(List *list, int index, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listInsert:list is NULL.\n");
+		return -1;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listInsert:list is empty.\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listInsert:index is out of bound.\n");
+		return -1;
+	}
+
+	if (insertAt(list, index, data) == -1) {
+		fprintf(stderr, "listInsert:malloc failed.\n");
+		return -1;
+	}
+	return 0;
+}
+
+// Stable merge of two NULL-terminated level 0 chains, linked after tail.
+// Returns the last node of the result.
+static Node *mergeChains(Node *left, Node *right, Node *tail, CompareFunction compare) {
+	while (left != NULL && right != NULL) {
+		if (compare(right->data, left->data) < 0) {
+			tail->links[0].next = right;
+			right = right->links[0].next;
+		}
+		else {
+			tail->links[0].next = left;
+			left = left->links[0].next;
+		}
+		tail = tail->links[0].next;
+	}
+	tail->links[0].next = (left != NULL) ? left : right;
+	while (tail->links[0].next != NULL)
+		tail = tail->links[0].next;
+	return tail;
+}
+
+// Cuts the chain after n nodes and returns the rest.
+static Node *splitChain(Node *node, int n) {
+	for (int i = 1; node != NULL && i < n; i++)
+		node = node->links[0].next;
+	if (node == NULL)
+		return NULL;
+	Node *rest = node->links[0].next;
+	node->links[0].next = NULL;
+	return rest;
+}
+
+// Merges runs of width 1, 2, 4, ... until one run is left.
+static void sortChain(Node *head, int count, CompareFunction compare) {
+	for (int width = 1; width < count; width *= 2) {
+		Node *tail = head;
+		Node *cur = head->links[0].next;
+		while (cur != NULL) {
+			Node *left = cur;
+			Node *right = splitChain(left, width);
+			cur = splitChain(right, width);
+			tail = mergeChains(left, right, tail, compare);
+		}
+	}
+}
+
+// Level 0 has been relinked; this puts prev, tail and every upper level back.
+// Each node keeps its own level, so the list stays as balanced as before.
+static void rebuildLevels(List *list) {
+	Node *last[MAX_LEVEL];
+	int positions[MAX_LEVEL];
+	for (int level = 0; level < MAX_LEVEL; level++) {
+		last[level] = list->head;
+		positions[level] = 0;
+	}
+
+	Node *prev = list->head;
+	int position = 0;
+	for (Node *node = list->head->links[0].next; node != NULL; node = node->links[0].next) {
+		node->prev = prev;
+		prev = node;
+		++position;
+		for (int level = 1; level < node->level; level++) {
+			last[level]->links[level].next = node;
+			last[level]->links[level].width = position - positions[level];
+			last[level] = node;
+			positions[level] = position;
+		}
+		node->links[0].width = 1;
+	}
+
+	for (int level = 1; level < MAX_LEVEL; level++) {
+		last[level]->links[level].next = NULL;
+		last[level]->links[level].width = position + 1 - positions[level];
+	}
+	list->tail = prev;
+}
+
+int listSort(List *list, CompareFunction compare) {
+	if (list == NULL || compare == NULL) {
+		fprintf(stderr, "listSort:argument is NULL.\n");
+		return -1;
+	}
+
+	if (list->count < 2)
+		return 0;
+
+	sortChain(list->head, list->count, compare);
+	rebuildLevels(list);
+	return 0;
+}
+
+int listMerge(List *list, List *other, CompareFunction compare) {
+	if (list == NULL || other == NULL || compare == NULL) {
+		fprintf(stderr, "listMerge:argument is NULL.\n");
+		return -1;
+	}
+
+	if (list == other) {
+		fprintf(stderr, "listMerge:lists are the same.\n");
+		return -1;
+	}
+
+	if (other->count == 0)
+		return 0;
+
+	mergeChains(list->head->links[0].next, other->head->links[0].next, list->head, compare);
+	list->count += other->count;
+	rebuildLevels(list);
+	resetHead(other);
+	return 0;
+}
@@ -0,0 +1,39 @@
+#ifndef _INDEXABLESKIPLIST_H_
+#define _INDEXABLESKIPLIST_H_
+
+typedef struct Node Node;
+typedef struct List List;
+typedef void(FreeFunction)(void *ptr);
+
+#ifndef MAX_LEVEL
+#define MAX_LEVEL (16)  //user can define the max level. 4^MAX_LEVEL elements stay O(log n).
+#endif
+
+// Same API as DoublyLinkedList.h, kept as an indexable skip list.
+// Every link stores how many elements it skips, so finding a position
+// follows O(log n) links, and listGet(), listSet(), listInsert() and
+// listRemove() are O(log n) instead of a walk from the nearer end.
+// Level 0 is an ordinary doubly linked list for displays and the ends.
+List *listInitialize(FreeFunction freeFunction);
+int listFinalize(List *list);
+void listDisplay(const List *list, const char *(*displayFunc)(const void *));
+void listReverseDisplay(const List *list, const char *(*displayFunc)(const void *));
+int listAddBack(List *list, void *data);
+int listAddFront(List *list, void *data);
+void *listRemove(List *list, int index);
+void *listRemoveHead(List *list);
+void *listRemoveTail(List *list);
+void *listGet(const List *list, int index);
+void *listSet(List *list, int index, void *newData);
+int listInsert(List *list, int index, void *data);
+
+// compare receives the data of two elements. listSort() is a stable bottom-up
+// merge sort of level 0; the upper levels are then relinked in one pass.
+// listMerge() moves every element of the sorted list other into the sorted list
+// list, keeping both orders; other is left empty.
+typedef int (*CompareFunction)(const void *data1, const void *data2);
+
+int listSort(List *list, CompareFunction compare);
+int listMerge(List *list, List *other, CompareFunction compare);
+
+#endif
@@ -0,0 +1,81 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "IndexableSkipList.h"
+
+typedef struct {
+	char name[32];
+	int age;
+} Person;
+
+const char *toPerson(const void *data) {
+	static char buf[48];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+int comparePerson(const void *data1, const void *data2) {
+	const Person *p1 = data1;
+	const Person *p2 = data2;
+	return (p1->age - p2->age);
+}
+
+// rand() may stop at 32767, so two calls make one index.
+int randomIndex(int n) {
+	return (int)((((unsigned int)rand() << 15) ^ (unsigned int)rand()) % (unsigned int)n);
+}
+
+int main() {
+	List *list = listInitialize(NULL);
+
+	Person people[5] = { {"A",1},{"B",2},{"C",3},{"D",4},{"E",5} };
+
+	for (int i = 0; i < 5; i++) {
+		listAddBack(list, people + i);
+		listDisplay(list, toPerson);
+	}
+
+	Person second = { "SECOND", 22 };
+	listInsert(list, 1, &second);
+	listDisplay(list, toPerson);
+
+	listRemove(list, 3);
+	listDisplay(list, toPerson);
+	listReverseDisplay(list, toPerson);
+
+	List *others = listInitialize(NULL);
+	Person more[3] = { {"F",6},{"G",0},{"H",3} };
+	for (int i = 0; i < 3; i++) {
+		listAddFront(others, more + i);
+	}
+	listSort(others, comparePerson);
+	listDisplay(others, toPerson);
+
+	listSort(list, comparePerson);
+	listMerge(list, others, comparePerson);
+	listDisplay(list, toPerson);
+	listReverseDisplay(list, toPerson);
+	listFinalize(others);
+	listFinalize(list);
+
+	// Random access on a long list follows O(log n) links.
+	const int count = 100000;
+	list = listInitialize(NULL);
+	for (int i = 0; i < count; i++)
+		listAddBack(list, people + i % 5);
+
+	clock_t start = clock();
+	srand(1);
+	for (int i = 0; i < count; i++) {
+		int index = randomIndex(count - 1);
+		listInsert(list, index, listRemove(list, index));
+		listGet(list, randomIndex(count));
+	}
+	printf("%d random remove/insert/get : %.3f sec\n", count,
+		(double)(clock() - start) / CLOCKS_PER_SEC);
+
+	listFinalize(list);
+	return 0;
+}
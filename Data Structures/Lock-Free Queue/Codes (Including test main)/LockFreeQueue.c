@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "LockFreeQueue.h"
+
+#define HAZARDS (2)  // hazard pointers per thread.
+#define RETIRE_THRESHOLD (2 * HAZARDS * MAX_THREADS)  // a scan then recycles at least half.
+
+typedef struct Node {
+	void *data;
+	_Atomic(struct Node *) next;  // queue link, or free list link once recycled.
+	struct Node *retiredNext;
+}Node;
+
+// A node a thread has published here is not recycled until the thread clears it.
+typedef struct HazardSlot {
+	_Atomic(Node *) hazard[HAZARDS];
+	Node *retired;
+	int retiredCount;
+	char padding[64];
+}HazardSlot;
+
+typedef struct Queue {
+	_Atomic(Node *) head;  // dummy node; the first element is head->next.
+	char padding1[64];
+	_Atomic(Node *) tail;
+	char padding2[64];
+	_Atomic(Node *) freeList;
+	atomic_int size;
+	HazardSlot slots[MAX_THREADS];
+}Queue;
+
+static atomic_bool slotInUse[MAX_THREADS];
+static _Thread_local int threadSlot = -1;
+
+static HazardSlot *acquireSlot(Queue *queue) {
+	if (threadSlot == -1) {
+		for (int i = 0; i < MAX_THREADS && threadSlot == -1; i++) {
+			bool expected = false;
+			if (atomic_compare_exchange_strong(&slotInUse[i], &expected, true))
+				threadSlot = i;
+		}
+		if (threadSlot == -1) {
+			fprintf(stderr, "acquireSlot : too many threads.\n");
+			return NULL;
+		}
+	}
+	return &queue->slots[threadSlot];
+}
+
+void queueThreadExit(void) {
+	if (threadSlot == -1)
+		return;
+	atomic_store(&slotInUse[threadSlot], false);
+	threadSlot = -1;
+}
+
+// Publishes the node in *src and checks that it is still there, so it
+// can't have been recycled before the hazard became visible.
+static Node *protect(HazardSlot *slot, int index, _Atomic(Node *) *src) {
+	Node *node = atomic_load(src);
+	while (1) {
+		atomic_store(&slot->hazard[index], node);
+		Node *again = atomic_load(src);
+		if (again == node)
+			return node;
+		node = again;
+	}
+}
+
+static void clearHazards(HazardSlot *slot) {
+	for (int i = 0; i < HAZARDS; i++)
+		atomic_store_explicit(&slot->hazard[i], NULL, memory_order_release);
+}
+
+static void pushFree(Queue *queue, Node *node) {
+	Node *top = atomic_load(&queue->freeList);
+	do {
+		atomic_store_explicit(&node->next, top, memory_order_relaxed);
+	} while (!atomic_compare_exchange_weak(&queue->freeList, &top, node));
+}
+
+// Treiber stack pop. The hazard on top prevents ABA : a popped node can't
+// come back to the free list while another thread still holds it.
+static Node *popFree(Queue *queue, HazardSlot *slot) {
+	while (1) {
+		Node *top = protect(slot, 0, &queue->freeList);
+		if (top == NULL)
+			return NULL;
+
+		Node *next = atomic_load(&top->next);
+		if (atomic_compare_exchange_weak(&queue->freeList, &top, next)) {
+			atomic_store_explicit(&slot->hazard[0], NULL, memory_order_release);
+			return top;
+		}
+	}
+}
+
+static int compareNode(const void *node1, const void *node2) {
+	const Node *a = *(Node *const *)node1;
+	const Node *b = *(Node *const *)node2;
+	return (a > b) - (a < b);
+}
+
+// Moves every retired node no thread is protecting to the free list.
+static void scan(Queue *queue, HazardSlot *slot) {
+	Node *hazards[MAX_THREADS * HAZARDS];
+	int count = 0;
+	for (int i = 0; i < MAX_THREADS; i++) {
+		for (int j = 0; j < HAZARDS; j++) {
+			Node *node = atomic_load(&queue->slots[i].hazard[j]);
+			if (node != NULL)
+				hazards[count++] = node;
+		}
+	}
+	qsort(hazards, count, sizeof(Node *), compareNode);
+
+	Node *node = slot->retired;
+	slot->retired = NULL;
+	slot->retiredCount = 0;
+	while (node != NULL) {
+		Node *next = node->retiredNext;
+		if (bsearch(&node, hazards, count, sizeof(Node *), compareNode) != NULL) {
+			node->retiredNext = slot->retired;
+			slot->retired = node;
+			++(slot->retiredCount);
+		}
+		else {
+			pushFree(queue, node);
+		}
+		node = next;
+	}
+}
+
+static void retire(Queue *queue, HazardSlot *slot, Node *node) {
+	node->retiredNext = slot->retired;
+	slot->retired = node;
+	if (++(slot->retiredCount) >= RETIRE_THRESHOLD)
+		scan(queue, slot);
+}
+
+static void freeNodes(Node *node, int retiredLink) {
+	while (node != NULL) {
+		Node *next = retiredLink ? node->retiredNext : atomic_load(&node->next);
+		free(node);
+		node = next;
+	}
+}
+
+Queue *queueCreate(void) {
+	Queue *queue = calloc(1, sizeof(Queue));
+	if (queue == NULL) {
+		fprintf(stderr, "queueCreate : calloc failed.\n");
+		return NULL;
+	}
+
+	Node *dummy = calloc(1, sizeof(Node));
+	if (dummy == NULL) {
+		fprintf(stderr, "queueCreate : calloc failed.\n");
+		free(queue);
+		return NULL;
+	}
+	atomic_init(&queue->head, dummy);
+	atomic_init(&queue->tail, dummy);
+	return queue;
+}
+
+void queueDestroy(Queue *queue) {
+	if (queue == NULL)
+		return;
+
+	freeNodes(atomic_load(&queue->head), 0);
+	freeNodes(atomic_load(&queue->freeList), 0);
+	for (int i = 0; i < MAX_THREADS; i++)
+		freeNodes(queue->slots[i].retired, 1);
+	free(queue);
+}
+
+int queueEnqueue(Queue *queue, void *data) {
+	if (queue == NULL || data == NULL) {
+		fprintf(stderr, "queueEnqueue : argument is NULL.\n");
+		return -1;
+	}
+
+	HazardSlot *slot = acquireSlot(queue);
+	if (slot == NULL)
+		return -1;
+
+	Node *node = popFree(queue, slot);
+	if (node == NULL) {
+		node = malloc(sizeof(Node));
+		if (node == NULL) {
+			fprintf(stderr, "queueEnqueue : malloc failed.\n");
+			return -1;
+		}
+	}
+	node->data = data;
+	atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+
+	Node *tail;
+	while (1) {
+		tail = protect(slot, 0, &queue->tail);
+		Node *next = atomic_load(&tail->next);
+		if (tail != atomic_load(&queue->tail))
+			continue;
+
+		// Another enqueue linked its node but hasn't moved tail yet : help it.
+		if (next != NULL) {
+			atomic_compare_exchange_strong(&queue->tail, &tail, next);
+			continue;
+		}
+
+		Node *expected = NULL;
+		if (atomic_compare_exchange_strong(&tail->next, &expected, node))
+			break;
+	}
+	atomic_compare_exchange_strong(&queue->tail, &tail, node);
+	clearHazards(slot);
+	atomic_fetch_add_explicit(&queue->size, 1, memory_order_relaxed);
+	return 0;
+}
+
+void *queueDequeue(Queue *queue) {
+	if (queue == NULL) {
+		fprintf(stderr, "queueDequeue : argument is NULL.\n");
+		return NULL;
+	}
+
+	HazardSlot *slot = acquireSlot(queue);
+	if (slot == NULL)
+		return NULL;
+
+	Node *head;
+	void *data;
+	while (1) {
+		head = protect(slot, 0, &queue->head);
+		Node *tail = atomic_load(&queue->tail);
+		Node *next = protect(slot, 1, &head->next);
+		if (head != atomic_load(&queue->head))
+			continue;
+
+		if (next == NULL) {
+			clearHazards(slot);
+			return NULL;
+		}
+
+		if (head == tail) {
+			atomic_compare_exchange_strong(&queue->tail, &tail, next);
+			continue;
+		}
+
+		// next becomes the new dummy node.
+		data = next->data;
+		if (atomic_compare_exchange_strong(&queue->head, &head, next))
+			break;
+	}
+	clearHazards(slot);
+	retire(queue, slot, head);
+	atomic_fetch_sub_explicit(&queue->size, 1, memory_order_relaxed);
+	return data;
+}
+
+int queueSize(const Queue *queue) {
+	if (queue == NULL) {
+		fprintf(stderr, "queueSize : argument is NULL.\n");
+		return -1;
+	}
+
+	int size = atomic_load_explicit(&queue->size, memory_order_relaxed);
+	return (size > 0) ? size : 0;
+}
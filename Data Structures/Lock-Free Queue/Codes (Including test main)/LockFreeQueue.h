@@ -0,0 +1,26 @@
+#ifndef _LOCKFREEQUEUE_H_
+#define _LOCKFREEQUEUE_H_
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_THREADS (64)  //user can define the max number of threads using a queue at once.
+
+typedef struct Node Node;
+typedef struct Queue Queue;
+
+// Michael-Scott queue : any number of threads can enqueue and dequeue at once
+// without a lock, except during queueCreate() and queueDestroy().
+// Removed nodes are protected by hazard pointers and then kept on a free list,
+// so enqueue only calls malloc when the queue is bigger than it has ever been.
+// data can't be NULL, because queueDequeue() returns NULL when the queue is empty.
+// queueSize() is exact only while no other thread changes the queue.
+Queue *queueCreate(void);
+void queueDestroy(Queue *queue);
+int queueEnqueue(Queue *queue, void *data);
+void *queueDequeue(Queue *queue);
+int queueSize(const Queue *queue);
+
+// A thread that stops using queues should call this to give its slot back.
+void queueThreadExit(void);
+
+#endif
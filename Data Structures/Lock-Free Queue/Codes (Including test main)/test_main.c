@@ -0,0 +1,98 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <threads.h>
+#include <stdatomic.h>
+#include "LockFreeQueue.h"
+
+typedef struct Person {
+	char name[32];
+	int age;
+}Person;
+
+const char *toPerson(const void *data) {
+	static char buf[48];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+// Throughput test : half the threads produce, half consume.
+#define ITEMS_PER_PRODUCER (1000000)
+
+static Queue *shared;
+static int item;
+static atomic_llong consumed;
+
+int producer(void *arg) {
+	(void)arg;
+	for (int i = 0; i < ITEMS_PER_PRODUCER; i++) {
+		while (queueEnqueue(shared, &item) == -1)
+			thrd_yield();
+	}
+	queueThreadExit();
+	return 0;
+}
+
+int consumer(void *arg) {
+	long long goal = *(long long *)arg;
+	while (atomic_load(&consumed) < goal) {
+		if (queueDequeue(shared) != NULL)
+			atomic_fetch_add(&consumed, 1);
+		else
+			thrd_yield();
+	}
+	queueThreadExit();
+	return 0;
+}
+
+static double now(void) {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main() {
+	Queue *queue = queueCreate();
+
+	Person people[5] = {
+		{"A", 11}, {"B", 22}, {"C", 33}, {"D", 44}, {"E", 55} };
+
+	printf("========queueEnqueue() test========\n\n");
+	for (int i = 0; i < 5; i++) {
+		queueEnqueue(queue, people + i);
+	}
+	printf("size : %d\n\n", queueSize(queue));
+
+	printf("========queueDequeue() test========\n\n");
+	Person *p;
+	while ((p = queueDequeue(queue)) != NULL)
+		printf("%s ", toPerson(p));
+	printf("\nsize : %d\n\n", queueSize(queue));
+	queueDestroy(queue);
+
+	printf("========throughput test========\n\n");
+	for (int threads = 2; threads <= 8; threads *= 2) {
+		shared = queueCreate();
+		atomic_store(&consumed, 0);
+		long long goal = (long long)(threads / 2) * ITEMS_PER_PRODUCER;
+
+		thrd_t tids[8];
+		double start = now();
+		for (int i = 0; i < threads; i++) {
+			if (i % 2 == 0)
+				thrd_create(&tids[i], producer, NULL);
+			else
+				thrd_create(&tids[i], consumer, &goal);
+		}
+		for (int i = 0; i < threads; i++)
+			thrd_join(tids[i], NULL);
+		double elapsed = now() - start;
+
+		printf("%d thread(s) : %.2f Mops/s\n", threads, 2 * goal / elapsed / 1e6);
+		queueDestroy(shared);
+	}
+	queueThreadExit();
+	return 0;
+}
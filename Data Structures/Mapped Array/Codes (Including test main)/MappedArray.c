@@ -0,0 +1,387 @@
+#define _GNU_SOURCE  //for mremap.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "MappedArray.h"
+
+#define MAGIC "ARRAYMAP"
+#define HEADER_SIZE (64)  //keeps the elements aligned.
+
+typedef struct FileHeader {
+	char magic[8];
+	uint64_t elemSize;
+	uint64_t count;
+}FileHeader;
+
+typedef struct Array {
+	int fd;
+	int readOnly;
+	char *base;  //mapping of the whole file.
+	size_t length;
+	size_t elemSize;
+	int size;
+}Array;
+
+static FileHeader *header(const Array *array) {
+	return (FileHeader *)array->base;
+}
+
+static char *slotAt(const Array *array, int index) {
+	return array->base + HEADER_SIZE + (size_t)index * array->elemSize;
+}
+
+static int isReadOnly(const Array *array, const char *caller) {
+	if (array->readOnly)
+		fprintf(stderr, "%s : array is read-only.\n", caller);
+	return array->readOnly;
+}
+
+static int mapFile(Array *array, size_t length) {
+	int prot = array->readOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+	void *base = mmap(NULL, length, prot, MAP_SHARED, array->fd, 0);
+	if (base == MAP_FAILED) {
+		perror("mapFile");
+		return -1;
+	}
+	array->base = base;
+	array->length = length;
+	return 0;
+}
+
+// An empty file gets a header; otherwise the header must match elemSize (0 accepts any).
+static int attach(Array *array, size_t elemSize) {
+	struct stat st;
+	if (fstat(array->fd, &st) == -1) {
+		perror("attach");
+		return -1;
+	}
+
+	if (st.st_size == 0) {
+		if (array->readOnly) {
+			fprintf(stderr, "attach : file is empty.\n");
+			return -1;
+		}
+		size_t length = HEADER_SIZE + (size_t)INITIAL_SIZE * elemSize;
+		if (ftruncate(array->fd, (off_t)length) == -1) {
+			perror("attach");
+			return -1;
+		}
+		if (mapFile(array, length) == -1)
+			return -1;
+		memcpy(header(array)->magic, MAGIC, sizeof(header(array)->magic));
+		header(array)->elemSize = elemSize;
+		header(array)->count = 0;
+		array->elemSize = elemSize;
+		array->size = INITIAL_SIZE;
+		return 0;
+	}
+
+	if (st.st_size < HEADER_SIZE) {
+		fprintf(stderr, "attach : file is too small.\n");
+		return -1;
+	}
+	if (mapFile(array, (size_t)st.st_size) == -1)
+		return -1;
+
+	FileHeader *head = header(array);
+	if (memcmp(head->magic, MAGIC, sizeof(head->magic)) != 0 || head->elemSize == 0) {
+		fprintf(stderr, "attach : not an array file.\n");
+		return -1;
+	}
+	if (elemSize != 0 && head->elemSize != elemSize) {
+		fprintf(stderr, "attach : element size doesn't match.\n");
+		return -1;
+	}
+
+	uint64_t capacity = (array->length - HEADER_SIZE) / head->elemSize;
+	if (head->count > capacity) {
+		fprintf(stderr, "attach : count exceeds the file.\n");
+		return -1;
+	}
+	array->elemSize = (size_t)head->elemSize;
+	array->size = (capacity < MAX_SIZE) ? (int)capacity : MAX_SIZE;
+	return 0;
+}
+
+static Array *openFile(const char *path, size_t elemSize, int readOnly) {
+	Array *array = calloc(1, sizeof(Array));
+	if (array == NULL) {
+		perror("openFile");
+		return NULL;
+	}
+
+	array->readOnly = readOnly;
+	array->fd = open(path, readOnly ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+	if (array->fd == -1) {
+		perror("openFile");
+		free(array);
+		return NULL;
+	}
+
+	if (attach(array, elemSize) == -1) {
+		if (array->base != NULL)
+			munmap(array->base, array->length);
+		close(array->fd);
+		free(array);
+		return NULL;
+	}
+	return array;
+}
+
+Array *arrayOpen(const char *path, size_t elemSize) {
+	if (path == NULL) {
+		fprintf(stderr, "arrayOpen : argument is null.\n");
+		return NULL;
+	}
+
+	if (elemSize == 0) {
+		fprintf(stderr, "arrayOpen : invalid element size.\n");
+		return NULL;
+	}
+	return openFile(path, elemSize, 0);
+}
+
+Array *arrayOpenReadOnly(const char *path) {
+	if (path == NULL) {
+		fprintf(stderr, "arrayOpenReadOnly : argument is null.\n");
+		return NULL;
+	}
+	return openFile(path, 0, 1);
+}
+
+int arraySync(Array *array) {
+	if (array == NULL) {
+		fprintf(stderr, "arraySync : argument is null.\n");
+		return -1;
+	}
+
+	if (msync(array->base, array->length, MS_SYNC) == -1) {
+		perror("arraySync");
+		return -1;
+	}
+	return 0;
+}
+
+// Changes reach the file without arraySync(), but only arraySync() waits for the disk.
+void arrayClose(Array *array) {
+	if (array == NULL)
+		return;
+	munmap(array->base, array->length);
+	close(array->fd);
+	free(array);
+}
+
+static int remap(Array *array, size_t length) {
+#ifdef MREMAP_MAYMOVE
+	void *base = mremap(array->base, array->length, length, MREMAP_MAYMOVE);
+	if (base == MAP_FAILED) {
+		perror("remap");
+		return -1;
+	}
+	array->base = base;
+	array->length = length;
+	return 0;
+#else
+	char *oldBase = array->base;
+	size_t oldLength = array->length;
+	if (mapFile(array, length) == -1)
+		return -1;
+	munmap(oldBase, oldLength);
+	return 0;
+#endif
+}
+
+static int increaseSize(Array *array, int size) {
+	if (size <= 0) {
+		fprintf(stderr, "increaseSize : invalid size value.\n");
+		return -1;
+	}
+
+	if (size <= array->size) {
+		return 0;
+	}
+
+	if (size > MAX_SIZE) {
+		fprintf(stderr, "increaseSize : size overflow.\n");
+		return -1;
+	}
+
+	// A file holding only the header has no capacity yet.
+	int newSize = (array->size > 0) ? array->size : INITIAL_SIZE;
+	while (newSize < size) {
+		newSize = (newSize > MAX_SIZE / 2) ? MAX_SIZE : newSize * 2;
+	}
+
+	if ((size_t)newSize > (SIZE_MAX - HEADER_SIZE) / array->elemSize) {
+		fprintf(stderr, "increaseSize : size overflow.\n");
+		return -1;
+	}
+
+	size_t length = HEADER_SIZE + (size_t)newSize * array->elemSize;
+	if (ftruncate(array->fd, (off_t)length) == -1) {
+		perror("increaseSize");
+		return -1;
+	}
+	if (remap(array, length) == -1)
+		return -1;
+
+	array->size = newSize;
+	return 0;
+}
+
+int arrayAddValue(Array *array, const void *value) {
+	if (array == NULL || value == NULL) {
+		fprintf(stderr, "arrayAddValue: argument is null\n");
+		return -1;
+	}
+
+	if (isReadOnly(array, "arrayAddValue"))
+		return -1;
+
+	int count = arrayCount(array);
+	if (increaseSize(array, count + 1) == -1) {
+		fprintf(stderr, "arrayAddValue : file growth failed\n");
+		return -1;
+	}
+
+	memcpy(slotAt(array, count), value, array->elemSize);
+	header(array)->count = count + 1;
+	return 0;
+}
+
+void arrayDisplay(const Array *array, const char *(*display)(const void *)) {
+
+	if (array == NULL || display == NULL) {
+		fprintf(stderr, "arrayDisplay : argument is null.\n");
+		return;
+	}
+
+	system("cls");
+	int count = arrayCount(array);
+	for (int i = 0; i < array->size; i++) {
+		if (i < count)
+			printf("[%s]", display(arrayGet(array, i)));
+		else
+			printf("[%2c]", ' ');
+	}
+	getchar();
+}
+
+int arraySetValue(Array *array, int index, const void *value) {
+	if (array == NULL || value == NULL) {
+		fprintf(stderr, "arraySetValue: argument is null\n");
+		return -1;
+	}
+
+	if (isReadOnly(array, "arraySetValue"))
+		return -1;
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arraySetValue: out of index\n");
+		return -1;
+	}
+
+	memcpy(slotAt(array, index), value, array->elemSize);
+	return 0;
+}
+
+int arrayInsertValue(Array *array, int index, const void *value) {
+	if (array == NULL || value == NULL) {
+		fprintf(stderr, "arrayInsertValue: argument is null\n");
+		return -1;
+	}
+
+	if (isReadOnly(array, "arrayInsertValue"))
+		return -1;
+
+	int count = arrayCount(array);
+	if (index < 0 || index >= count) {
+		fprintf(stderr, "arrayInsertValue: out of index\n");
+		return -1;
+	}
+
+	if (increaseSize(array, count + 1) == -1) {
+		fprintf(stderr, "arrayInsertValue : file growth failed\n");
+		return -1;
+	}
+
+	memmove(slotAt(array, index + 1), slotAt(array, index),
+		array->elemSize * (count - index));
+
+	memcpy(slotAt(array, index), value, array->elemSize);
+	header(array)->count = count + 1;
+	return 0;
+}
+
+// A reader may map less of the file than a writer has filled since.
+int arrayCount(const Array *array) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayCount: argument is null\n");
+		return -1;
+	}
+
+	uint64_t count = header(array)->count;
+	return (count < (uint64_t)array->size) ? (int)count : array->size;
+}
+
+int arrayGetValue(const Array *array, int index, void *outValue) {
+	if (array == NULL || outValue == NULL) {
+		fprintf(stderr, "arrayGetValue: argument is null\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arrayGetValue: out of index\n");
+		return -1;
+	}
+
+	memcpy(outValue, slotAt(array, index), array->elemSize);
+	return 0;
+}
+
+void *arrayGet(const Array *array, int index) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayGet: argument is null\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= arrayCount(array)) {
+		fprintf(stderr, "arrayGet: out of index\n");
+		return NULL;
+	}
+	return slotAt(array, index);
+}
+
+int arrayRemoveValue(Array *array, int index, void *outValue) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayRemoveValue: argument is null\n");
+		return -1;
+	}
+
+	if (isReadOnly(array, "arrayRemoveValue"))
+		return -1;
+
+	int count = arrayCount(array);
+	if (count == 0) {
+		fprintf(stderr, "arrayRemoveValue: array is empty\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= count) {
+		fprintf(stderr, "arrayRemoveValue: out of index\n");
+		return -1;
+	}
+
+	if (outValue != NULL)
+		memcpy(outValue, slotAt(array, index), array->elemSize);
+
+	memmove(slotAt(array, index), slotAt(array, index + 1),
+		array->elemSize * (count - index - 1));
+	header(array)->count = count - 1;
+	return 0;
+}
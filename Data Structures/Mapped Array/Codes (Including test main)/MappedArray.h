@@ -0,0 +1,40 @@
+#ifndef _MAPPEDARRAY_H_
+#define _MAPPEDARRAY_H_
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct Array Array;  //For data-hiding.
+
+#ifndef INITIAL_SIZE
+#define INITIAL_SIZE	(4)  //user can define the initial size.
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (1 << 30)  //user can define the max size of the array.
+#endif
+
+// Array of fixed-size values kept in a file mapped with mmap (POSIX only).
+// The file is a small header (magic, element size, count) followed by the
+// elements, so reopening it needs no parsing and pages are read on demand.
+// Growing the file uses ftruncate and mremap, or a new mapping where mremap
+// is missing. The file is in native byte order.
+//
+// arrayOpen() creates the file if it is empty and checks elemSize otherwise.
+// arrayOpenReadOnly() maps an existing file so that many processes share it.
+// arrayGet() returns the address of the element, valid until the array grows.
+Array *arrayOpen(const char *path, size_t elemSize);
+Array *arrayOpenReadOnly(const char *path);
+int arraySync(Array *array);
+void arrayClose(Array *array);
+
+int arrayAddValue(Array *array, const void *value);
+void arrayDisplay(const Array *array, const char *(*display)(const void *));
+int arraySetValue(Array *array, int index, const void *value);
+int arrayInsertValue(Array *array, int index, const void *value);
+int arrayCount(const Array *array);
+int arrayGetValue(const Array *array, int index, void *outValue);
+void *arrayGet(const Array *array, int index);
+int arrayRemoveValue(Array *array, int index, void *outValue);
+
+#endif
@@ -0,0 +1,52 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include "MappedArray.h"
+
+typedef struct {
+	char name[32];
+	int age;
+} Person;
+
+const char *toPerson(const void *data) {
+	static char buf[48];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+int main() {
+	Person people[5] = {
+		{"A", 11}, {"B", 22}, {"C", 33}, {"D", 44}, {"E", 55} };
+
+	// The first run fills the file. Later runs find the people already there.
+	Array *arr = arrayOpen("people.dat", sizeof(Person));
+	if (arr == NULL)
+		return 1;
+
+	if (arrayCount(arr) == 0) {
+		for (int i = 0; i < 4; i++) {
+			arrayAddValue(arr, people + i);
+			arrayDisplay(arr, toPerson);
+		}
+		arrayInsertValue(arr, 0, people + 4);
+	}
+	arrayDisplay(arr, toPerson);
+	arraySync(arr);
+
+	// A reader maps the same pages and can't change them.
+	Array *reader = arrayOpenReadOnly("people.dat");
+	if (reader != NULL) {
+		printf("reader sees %d people\n", arrayCount(reader));
+		if (arrayRemoveValue(reader, 0, NULL) == -1)
+			printf("reader can't remove\n");
+		arrayClose(reader);
+	}
+
+	Person removed;
+	arrayRemoveValue(arr, 0, &removed);
+	printf("removed : %s\n", toPerson(&removed));
+	arrayAddValue(arr, &removed);
+	arrayDisplay(arr, toPerson);
+
+	arrayClose(arr);
+}
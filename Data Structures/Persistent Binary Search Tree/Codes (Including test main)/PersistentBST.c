@@ -0,0 +1,268 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "PersistentBST.h"
+
+typedef struct Node {
+	void *data;
+	struct Node *left;
+	struct Node *right;
+	atomic_int refCount;
+}Node;
+
+typedef struct BST {
+	Node *root;
+	DisplayFunction displayFunction;
+	CompareFunction compareFunction;
+	atomic_int refCount;
+}BST;
+
+static Node *retainNode(Node *node) {
+	if (node != NULL)
+		atomic_fetch_add(&node->refCount, 1);
+	return node;
+}
+
+static void releaseNode(Node *node) {
+	if (node == NULL)
+		return;
+
+	if (atomic_fetch_sub(&node->refCount, 1) != 1)
+		return;
+
+	releaseNode(node->left);
+	releaseNode(node->right);
+	free(node);
+}
+
+// The new node takes over the references to left and right.
+static Node *createNode(void *data, Node *left, Node *right) {
+	Node *node = malloc(sizeof(Node));
+	if (node == NULL) {
+		fprintf(stderr, "createNode : malloc failed.\n");
+		releaseNode(left);
+		releaseNode(right);
+		return NULL;
+	}
+	node->data = data;
+	node->left = left;
+	node->right = right;
+	atomic_init(&node->refCount, 1);
+	return node;
+}
+
+static BST *createVersion(const BST *bst, Node *root) {
+	BST *version = malloc(sizeof(BST));
+	if (version == NULL) {
+		fprintf(stderr, "createVersion : malloc failed.\n");
+		releaseNode(root);
+		return NULL;
+	}
+	version->root = root;
+	version->displayFunction = bst->displayFunction;
+	version->compareFunction = bst->compareFunction;
+	atomic_init(&version->refCount, 1);
+	return version;
+}
+
+BST *bstCreate(DisplayFunction displayFunction, CompareFunction compareFunction) {
+
+	if (displayFunction == NULL || compareFunction == NULL) {
+		fprintf(stderr, "bstCreate : argument is NULL.\n");
+		return NULL;
+	}
+
+	BST *bst = calloc(1, sizeof(BST));
+	if (bst == NULL) {
+		fprintf(stderr, "bstCreate : calloc failed.\n");
+		return NULL;
+	}
+	bst->displayFunction = displayFunction;
+	bst->compareFunction = compareFunction;
+	atomic_init(&bst->refCount, 1);
+	return bst;
+}
+
+BST *bstSnapshot(BST *bst) {
+	if (bst == NULL) {
+		fprintf(stderr, "bstSnapshot : argument is NULL.\n");
+		return NULL;
+	}
+	atomic_fetch_add(&bst->refCount, 1);
+	return bst;
+}
+
+void bstRelease(BST *bst) {
+	if (bst == NULL)
+		return;
+
+	if (atomic_fetch_sub(&bst->refCount, 1) != 1)
+		return;
+
+	releaseNode(bst->root);
+	free(bst);
+}
+
+// Returns 0 and the new subtree in *result, or -1 if data already exists.
+static int _insert(const BST *bst, Node *node, void *data, Node **result) {
+	if (node == NULL) {
+		*result = createNode(data, NULL, NULL);
+		return (*result == NULL) ? -1 : 0;
+	}
+
+	int cmp = bst->compareFunction(data, node->data);
+	if (cmp == 0)
+		return -1;
+
+	Node *child;
+	if (cmp < 0) {
+		if (_insert(bst, node->left, data, &child) == -1)
+			return -1;
+		*result = createNode(node->data, child, retainNode(node->right));
+	}
+	else {
+		if (_insert(bst, node->right, data, &child) == -1)
+			return -1;
+		*result = createNode(node->data, retainNode(node->left), child);
+	}
+	return (*result == NULL) ? -1 : 0;
+}
+
+BST *bstInsert(const BST *bst, void *data) {
+	if (bst == NULL || data == NULL) {
+		fprintf(stderr, "bstInsert : argument is NULL.\n");
+		return NULL;
+	}
+
+	Node *root;
+	if (_insert(bst, bst->root, data, &root) == -1) {
+		fprintf(stderr, "bstInsert : insert failed.\n");
+		return NULL;
+	}
+	return createVersion(bst, root);
+}
+
+// Returns 0 and the new subtree in *result, or -1 if key doesn't exist.
+static int _remove(const BST *bst, Node *node, void *key, Node **result, void **outData) {
+	if (node == NULL)
+		return -1;
+
+	int cmp = bst->compareFunction(key, node->data);
+	Node *child;
+	if (cmp < 0) {
+		if (_remove(bst, node->left, key, &child, outData) == -1)
+			return -1;
+		*result = createNode(node->data, child, retainNode(node->right));
+	}
+	else if (cmp > 0) {
+		if (_remove(bst, node->right, key, &child, outData) == -1)
+			return -1;
+		*result = createNode(node->data, retainNode(node->left), child);
+	}
+	else {
+		*outData = node->data;
+		if (node->left == NULL) {
+			*result = retainNode(node->right);
+			return 0;
+		}
+		if (node->right == NULL) {
+			*result = retainNode(node->left);
+			return 0;
+		}
+
+		// The successor's data moves up; only its path is copied.
+		Node *candidate = node->right;
+		while (candidate->left != NULL)
+			candidate = candidate->left;
+
+		void *candidateData;
+		if (_remove(bst, node->right, candidate->data, &child, &candidateData) == -1)
+			return -1;
+		*result = createNode(candidateData, retainNode(node->left), child);
+	}
+	return (*result == NULL) ? -1 : 0;
+}
+
+BST *bstRemove(const BST *bst, void *key, void **outData) {
+	if (bst == NULL || key == NULL) {
+		fprintf(stderr, "bstRemove : argument is NULL.\n");
+		return NULL;
+	}
+
+	Node *root;
+	void *data;
+	if (_remove(bst, bst->root, key, &root, &data) == -1) {
+		fprintf(stderr, "bstRemove : Node doesn't exist.\n");
+		return NULL;
+	}
+
+	BST *version = createVersion(bst, root);
+	if (version != NULL && outData != NULL)
+		*outData = data;
+	return version;
+}
+
+void *bstGet(const BST *bst, void *key) {
+	if (bst == NULL || key == NULL) {
+		fprintf(stderr, "bstGet : argument is NULL.\n");
+		return NULL;
+	}
+
+	Node *cur = bst->root;
+	while (cur != NULL) {
+		int cmp = bst->compareFunction(key, cur->data);
+		if (cmp < 0)
+			cur = cur->left;
+		else if (cmp > 0)
+			cur = cur->right;
+		else
+			return cur->data;
+	}
+	return NULL;
+}
+
+static void _preorder(const BST *bst, Node *node) {
+
+	if (node == NULL)
+		return;
+
+	printf("%s ", bst->displayFunction(node->data));
+	_preorder(bst, node->left);
+	_preorder(bst, node->right);
+}
+
+void preorder(const BST *bst) {
+	printf("preorder : ");
+	_preorder(bst, bst->root);
+	printf("\n");
+}
+
+static void _inorder(const BST *bst, Node *node) {
+	if (node == NULL)
+		return;
+
+	_inorder(bst, node->left);
+	printf("%s ", bst->displayFunction(node->data));
+	_inorder(bst, node->right);
+}
+
+void inorder(const BST *bst) {
+	printf("inorder : ");
+	_inorder(bst, bst->root);
+	printf("\n");
+}
+
+static void _postorder(const BST *bst, Node *node) {
+	if (node == NULL)
+		return;
+
+	_postorder(bst, node->left);
+	_postorder(bst, node->right);
+	printf("%s ", bst->displayFunction(node->data));
+}
+
+void postorder(const BST *bst) {
+	printf("postorder : ");
+	_postorder(bst, bst->root);
+	printf("\n");
+}
@@ -0,0 +1,25 @@
+#ifndef _PERSISTENTBST_H_
+#define _PERSISTENTBST_H_
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct Node Node;
+typedef struct BST BST;  // One version of the tree.
+
+typedef const char *(*DisplayFunction)(void *data);
+typedef int (*CompareFunction)(void *data1, void *data2);
+
+// A version never changes. bstInsert() and bstRemove() copy only the path
+// to the changed node and return a new version sharing every other node.
+// Versions can be read from many threads; nodes are reference counted.
+BST *bstCreate(DisplayFunction, CompareFunction);
+BST *bstInsert(const BST *bst, void *data);
+BST *bstRemove(const BST *bst, void *key, void **outData);
+void *bstGet(const BST *bst, void *key);
+BST *bstSnapshot(BST *bst);
+void bstRelease(BST *bst);
+void preorder(const BST *bst);
+void inorder(const BST *bst);
+void postorder(const BST *bst);
+
+#endif
@@ -0,0 +1,76 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include "PersistentBST.h"
+
+typedef struct Person {
+	char name[32];
+	int age;
+}Person;
+
+const char *toPerson(void *data) {
+	static char buf[32];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+int comparePerson(void *data1, void *data2) {
+	const Person *p1 = data1;
+	const Person *p2 = data2;
+	return (p1->age - p2->age);
+}
+
+int main() {
+
+	// This test code uses Person's age as the Node's key.
+
+	BST *bst = bstCreate(toPerson, comparePerson);
+
+	Person people[8] = { {"FOUR", 40}, {"TWO", 20}, {"ONE", 10}, {"THREE", 30}, {"SIX",60}, {"FIVE", 50}, {"SEVEN", 70}, {"EIGHT", 80} };
+	for (int i = 0; i < 8; i++) {
+		BST *next = bstInsert(bst, people + i);
+		if (next != NULL) {
+			bstRelease(bst);
+			bst = next;
+		}
+	}
+
+	printf("========ordering test========\n\n");
+	preorder(bst);
+	inorder(bst);
+	postorder(bst);
+
+	printf("========bstGet() test========\n\n");
+	for (int i = 0; i < 8; i++) {
+		void *data = bstGet(bst, people + i);
+		if (data != NULL)
+			printf("%s\n", toPerson(data));
+	}
+
+	printf("========bstSnapshot() test========\n\n");
+	BST *snapshot = bstSnapshot(bst);
+
+	int ages[3] = { 40, 10, 70 };
+	for (int i = 0; i < 3; i++) {
+		Person key = { "TMP", ages[i] };
+		void *removed;
+		BST *next = bstRemove(bst, &key, &removed);
+		if (next == NULL) {
+			printf("bstRemove failed.\n");
+			continue;
+		}
+		printf("Removed data : %s\n", toPerson(removed));
+		bstRelease(bst);
+		bst = next;
+	}
+
+	printf("\nlatest version\n");
+	inorder(bst);
+	printf("snapshot\n");
+	inorder(snapshot);
+
+	bstRelease(snapshot);
+	bstRelease(bst);
+	return 0;
+}
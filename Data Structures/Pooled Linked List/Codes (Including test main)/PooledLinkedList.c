@@ -0,0 +1,340 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include "PooledLinkedList.h"
+
+#define SENTINEL (0)  // nodes[0] is both head and tail; a node is never freed to index 0.
+
+
+typedef struct Node {
+	void *data;
+	uint32_t next;  // also links the free list.
+	uint32_t prev;
+}Node;
+
+typedef struct List {
+	Node *nodes;
+	uint32_t capacity;
+	uint32_t freeHead;  // first free node, or SENTINEL when the pool is full.
+	int count;
+	FreeFunction *freeFunction;
+}List;
+
+// Chains nodes[from] .. nodes[capacity - 1] into the free list.
+static void addFreeNodes(List *list, uint32_t from) {
+	for (uint32_t i = from; i < list->capacity - 1; i++)
+		list->nodes[i].next = i + 1;
+	list->nodes[list->capacity - 1].next = list->freeHead;
+	list->freeHead = from;
+}
+
+static uint32_t allocNode(List *list) {
+	if (list->freeHead == SENTINEL) {
+		if (list->capacity > INT_MAX / 2)
+			return SENTINEL;
+
+		Node *nodes = realloc(list->nodes, sizeof(Node) * list->capacity * 2);
+		if (nodes == NULL)
+			return SENTINEL;
+
+		list->nodes = nodes;
+		uint32_t from = list->capacity;
+		list->capacity *= 2;
+		addFreeNodes(list, from);
+	}
+
+	uint32_t index = list->freeHead;
+	list->freeHead = list->nodes[index].next;
+	return index;
+}
+
+static void freeNode(List *list, uint32_t index) {
+	list->nodes[index].next = list->freeHead;
+	list->freeHead = index;
+}
+
+// Links a new node holding data after prev. Returns -1 if the pool can't grow.
+static int linkAfter(List *list, uint32_t prev, void *data) {
+	uint32_t index = allocNode(list);
+	if (index == SENTINEL)
+		return -1;
+
+	Node *nodes = list->nodes;
+	nodes[index].data = data;
+	nodes[index].prev = prev;
+	nodes[index].next = nodes[prev].next;
+	nodes[nodes[prev].next].prev = index;
+	nodes[prev].next = index;
+	++(list->count);
+	return 0;
+}
+
+static void *unlinkNode(List *list, uint32_t index) {
+	Node *nodes = list->nodes;
+	nodes[nodes[index].prev].next = nodes[index].next;
+	nodes[nodes[index].next].prev = nodes[index].prev;
+	void *outData = nodes[index].data;
+	freeNode(list, index);
+	--(list->count);
+	return outData;
+}
+
+static uint32_t getNodeAtIndex(const List *list, int index) {
+	uint32_t node;
+	if (index <= (list->count) >> 1) {
+		node = list->nodes[SENTINEL].next;
+		for (int i = 0; i < index; i++)
+			node = list->nodes[node].next;
+	}
+	else {
+		node = list->nodes[SENTINEL].prev;
+		for (int i = list->count - 1; i > index; i--)
+			node = list->nodes[node].prev;
+	}
+	return node;
+}
+
+List *listInitialize(FreeFunction freeFunction) {
+
+	List *list = calloc(1, sizeof(List));
+	if (list == NULL) {
+		fprintf(stderr, "listInitialize:calloc failed.\n");
+		return NULL;
+	}
+
+	list->nodes = malloc(sizeof(Node) * INITIAL_SIZE);
+	if (list->nodes == NULL) {
+		fprintf(stderr, "listInitialize:malloc failed.\n");
+		free(list);
+		return NULL;
+	}
+
+	list->capacity = INITIAL_SIZE;
+	list->nodes[SENTINEL].data = NULL;
+	list->nodes[SENTINEL].next = SENTINEL;
+	list->nodes[SENTINEL].prev = SENTINEL;
+	list->freeHead = SENTINEL;
+	if (list->capacity > 1)
+		addFreeNodes(list, 1);
+	list->freeFunction = freeFunction;
+	return list;
+}
+
+int listFinalize(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listFinalize:list is NULL.\n");
+		return -1;
+	}
+
+	if (list->freeFunction) {
+		for (uint32_t node = list->nodes[SENTINEL].next; node != SENTINEL; node = list->nodes[node].next)
+			list->freeFunction(list->nodes[node].data);
+	}
+	free(list->nodes);
+	free(list);
+	return 0;
+}
+
+void listDisplay(const List *list, const char *(*displayFunc)(const void *)) {
+	if (list == NULL) {
+		fprintf(stderr, "listDisplay:list is NULL.\n");
+		return;
+	}
+
+	system("cls");
+	printf("[head]");
+	for (uint32_t node = list->nodes[SENTINEL].next; node != SENTINEL; node = list->nodes[node].next)
+		printf("<->[%s]", displayFunc(list->nodes[node].data));
+	printf("<->[tail]");
+	getchar();
+}
+
+void listReverseDisplay(const List *list, const char *(*displayFunc)(const void *)) {
+	if (list == NULL) {
+		fprintf(stderr, "listDisplay:list is NULL.\n");
+		return;
+	}
+
+	system("cls");
+	printf("[tail]");
+	for (uint32_t node = list->nodes[SENTINEL].prev; node != SENTINEL; node = list->nodes[node].prev)
+		printf("<->[%s]", displayFunc(list->nodes[node].data));
+	printf("<->[head]");
+	getchar();
+}
+
+int listAddBack(List *list, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listAdd:list is NULL.\n");
+		return -1;
+	}
+
+	if (linkAfter(list, list->nodes[SENTINEL].prev, data) == -1) {
+		fprintf(stderr, "listAdd:realloc failed.\n");
+		return -1;
+	}
+	return 0;
+}
+
+int listAddFront(List *list, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listAddFront:list is NULL.\n");
+		return -1;
+	}
+
+	if (linkAfter(list, SENTINEL, data) == -1) {
+		fprintf(stderr, "listAddFront:realloc failed.\n");
+		return -1;
+	}
+	return 0;
+}
+
+void *listRemove(List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemove:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemove:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listRemove:index is out of bound.\n");
+		return NULL;
+	}
+
+	return unlinkNode(list, getNodeAtIndex(list, index));
+}
+
+void *listRemoveHead(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemoveHead:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemoveHead:list is empty.\n");
+		return NULL;
+	}
+
+	return unlinkNode(list, list->nodes[SENTINEL].next);
+}
+
+void *listRemoveTail(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemoveTail:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemoveTail:list is empty.\n");
+		return NULL;
+	}
+
+	return unlinkNode(list, list->nodes[SENTINEL].prev);
+}
+
+void *listGet(const List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listGet:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listGet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listGet:index is out of bound.\n");
+		return NULL;
+	}
+
+	return list->nodes[getNodeAtIndex(list, index)].data;
+}
+
+void *listSet(List *list, int index, void *newData) {
+	if (list == NULL) {
+		fprintf(stderr, "listSet:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listSet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listSet:index is out of bound.\n");
+		return NULL;
+	}
+
+	Node *node = &list->nodes[getNodeAtIndex(list, index)];
+	void *oldData = node->data;
+	node->data = newData;
+	return oldData;
+}
+
+int listInsert(List *list, int index, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listInsert:list is NULL.\n");
+		return -1;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listInsert:list is empty.\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listInsert:index is out of bound.\n");
+		return -1;
+	}
+
+	uint32_t prev = list->nodes[getNodeAtIndex(list, index)].prev;
+	if (linkAfter(list, prev, data) == -1) {
+		fprintf(stderr, "listInsert:realloc failed.\n");
+		return -1;
+	}
+	return 0;
+}
+
+int listCount(const List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listCount:list is NULL.\n");
+		return -1;
+	}
+	return list->count;
+}
+
+List *listClone(const List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listClone:list is NULL.\n");
+		return NULL;
+	}
+
+	List *clone = malloc(sizeof(List));
+	if (clone == NULL) {
+		fprintf(stderr, "listClone:malloc failed.\n");
+		return NULL;
+	}
+
+	clone->nodes = malloc(sizeof(Node) * list->capacity);
+	if (clone->nodes == NULL) {
+		fprintf(stderr, "listClone:malloc failed.\n");
+		free(clone);
+		return NULL;
+	}
+
+	memcpy(clone->nodes, list->nodes, sizeof(Node) * list->capacity);
+	clone->capacity = list->capacity;
+	clone->freeHead = list->freeHead;
+	clone->count = list->count;
+	clone->freeFunction = NULL;
+	return clone;
+}
@@ -0,0 +1,33 @@
+#ifndef _POOLEDLINKEDLIST_H_
+#define _POOLEDLINKEDLIST_H_
+
+typedef struct List List;  //For data-hiding.
+typedef void(FreeFunction)(void *ptr);
+
+#ifndef INITIAL_SIZE
+#define INITIAL_SIZE (16)  //user can define the initial number of nodes in the pool.
+#endif
+
+// Same API as DoublyLinkedList.h, but every node lives in one array and
+// links to its neighbours by 32-bit index : 16 bytes a node on 64-bit
+// machines instead of 24 bytes plus a malloc header.
+// Removed nodes go to a free list inside the array, and the array doubles
+// when it runs out, so adding an element rarely allocates.
+// Nothing holds a pointer into the array, so listClone() copies a list
+// with a single memcpy. The clone shares the data and has no FreeFunction.
+List *listInitialize(FreeFunction freeFunction);
+int listFinalize(List *list);
+void listDisplay(const List *list, const char *(*displayFunc)(const void *));
+void listReverseDisplay(const List *list, const char *(*displayFunc)(const void *));
+int listAddBack(List *list, void *data);
+int listAddFront(List *list, void *data);
+void *listRemove(List *list, int index);
+void *listRemoveHead(List *list);
+void *listRemoveTail(List *list);
+void *listGet(const List *list, int index);
+void *listSet(List *list, int index, void *newData);
+int listInsert(List *list, int index, void *data);
+int listCount(const List *list);
+List *listClone(const List *list);
+
+#endif
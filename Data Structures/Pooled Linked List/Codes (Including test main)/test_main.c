@@ -0,0 +1,49 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include "PooledLinkedList.h"
+
+typedef struct {
+	char name[32];
+	int age;
+} Person;
+
+const char *toPerson(const void *data) {
+	static char buf[48];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+int main() {
+	List *list = listInitialize(NULL);
+
+	Person people[5] = { {"A",1},{"B",2},{"C",3},{"D",4},{"E",5} };
+
+	for (int i = 0; i < 5; i++) {
+		listAddBack(list, people + i);
+		listDisplay(list, toPerson);
+	}
+
+	Person second = { "SECOND", 22 };
+	listInsert(list, 1, &second);
+	listDisplay(list, toPerson);
+
+	// The removed node goes back to the pool and the next add reuses it.
+	listRemove(list, 3);
+	listDisplay(list, toPerson);
+	listAddFront(list, people + 2);
+	listDisplay(list, toPerson);
+	listReverseDisplay(list, toPerson);
+
+	// The clone is one copy of the pool; changing it leaves list alone.
+	List *clone = listClone(list);
+	listRemoveHead(clone);
+	listRemoveTail(clone);
+	listDisplay(clone, toPerson);
+	listDisplay(list, toPerson);
+
+	listFinalize(clone);
+	listFinalize(list);
+	return 0;
+}
@@ -0,0 +1,279 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RingBufferDeque.h"
+
+
+// Element i is elements[(head + i) & (capacity - 1)].
+typedef struct List {
+	void **elements;
+	int capacity;
+	int head;
+	int count;
+	FreeFunction *freeFunction;
+}List;
+
+static void **slot(const List *list, int index) {
+	return &list->elements[(list->head + index) & (list->capacity - 1)];
+}
+
+// Doubles the buffer and unwraps the elements to the start of it.
+static int increaseSize(List *list) {
+	if (list->count < list->capacity)
+		return 0;
+
+	void **elements = malloc(sizeof(void *) * list->capacity * 2);
+	if (elements == NULL)
+		return -1;
+
+	int first = list->capacity - list->head;
+	memcpy(elements, list->elements + list->head, sizeof(void *) * first);
+	memcpy(elements + first, list->elements, sizeof(void *) * (list->count - first));
+	free(list->elements);
+	list->elements = elements;
+	list->head = 0;
+	list->capacity *= 2;
+	return 0;
+}
+
+List *listInitialize(FreeFunction freeFunction) {
+
+	List *list = calloc(1, sizeof(List));
+	if (list == NULL) {
+		fprintf(stderr, "listInitialize:calloc failed.\n");
+		return NULL;
+	}
+
+	list->elements = malloc(sizeof(void *) * INITIAL_SIZE);
+	if (list->elements == NULL) {
+		fprintf(stderr, "listInitialize:malloc failed.\n");
+		free(list);
+		return NULL;
+	}
+
+	list->capacity = INITIAL_SIZE;
+	list->freeFunction = freeFunction;
+	return list;
+}
+
+int listFinalize(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listFinalize:list is NULL.\n");
+		return -1;
+	}
+
+	if (list->freeFunction) {
+		for (int i = 0; i < list->count; i++)
+			list->freeFunction(*slot(list, i));
+	}
+	free(list->elements);
+	free(list);
+	return 0;
+}
+
+void listDisplay(const List *list, const char *(*displayFunc)(const void *)) {
+	if (list == NULL) {
+		fprintf(stderr, "listDisplay:list is NULL.\n");
+		return;
+	}
+
+	system("cls");
+	printf("[head]");
+	for (int i = 0; i < list->count; i++)
+		printf("<->[%s]", displayFunc(*slot(list, i)));
+	printf("<->[tail]");
+	getchar();
+}
+
+void listReverseDisplay(const List *list, const char *(*displayFunc)(const void *)) {
+	if (list == NULL) {
+		fprintf(stderr, "listDisplay:list is NULL.\n");
+		return;
+	}
+
+	system("cls");
+	printf("[tail]");
+	for (int i = list->count - 1; i >= 0; i--)
+		printf("<->[%s]", displayFunc(*slot(list, i)));
+	printf("<->[head]");
+	getchar();
+}
+
+int listAddBack(List *list, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listAdd:list is NULL.\n");
+		return -1;
+	}
+
+	if (increaseSize(list) == -1) {
+		fprintf(stderr, "listAdd:malloc failed.\n");
+		return -1;
+	}
+
+	*slot(list, list->count) = data;
+	++(list->count);
+	return 0;
+}
+
+int listAddFront(List *list, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listAddFront:list is NULL.\n");
+		return -1;
+	}
+
+	if (increaseSize(list) == -1) {
+		fprintf(stderr, "listAddFront:malloc failed.\n");
+		return -1;
+	}
+
+	list->head = (list->head - 1) & (list->capacity - 1);
+	list->elements[list->head] = data;
+	++(list->count);
+	return 0;
+}
+
+void *listRemove(List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemove:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemove:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listRemove:index is out of bound.\n");
+		return NULL;
+	}
+
+	void *outData = *slot(list, index);
+	if (index < list->count / 2) {
+		for (int i = index; i > 0; i--)
+			*slot(list, i) = *slot(list, i - 1);
+		list->head = (list->head + 1) & (list->capacity - 1);
+	}
+	else {
+		for (int i = index; i < list->count - 1; i++)
+			*slot(list, i) = *slot(list, i + 1);
+	}
+	--(list->count);
+	return outData;
+}
+
+void *listRemoveHead(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemoveHead:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemoveHead:list is empty.\n");
+		return NULL;
+	}
+
+	void *outData = list->elements[list->head];
+	list->head = (list->head + 1) & (list->capacity - 1);
+	--(list->count);
+	return outData;
+}
+
+void *listRemoveTail(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemoveTail:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemoveTail:list is empty.\n");
+		return NULL;
+	}
+
+	--(list->count);
+	return *slot(list, list->count);
+}
+
+void *listGet(const List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listGet:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listGet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listGet:index is out of bound.\n");
+		return NULL;
+	}
+
+	return *slot(list, index);
+}
+
+void *listSet(List *list, int index, void *newData) {
+	if (list == NULL) {
+		fprintf(stderr, "listSet:list is NULL.\n");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listSet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listSet:index is out of bound.\n");
+		return NULL;
+	}
+
+	void *oldData = *slot(list, index);
+	*slot(list, index) = newData;
+	return oldData;
+}
+
+int listInsert(List *list, int index, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listInsert:list is NULL.\n");
+		return -1;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listInsert:list is empty.\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listInsert:index is out of bound.\n");
+		return -1;
+	}
+
+	if (increaseSize(list) == -1) {
+		fprintf(stderr, "listInsert:malloc failed.\n");
+		return -1;
+	}
+
+	if (index < list->count / 2) {
+		list->head = (list->head - 1) & (list->capacity - 1);
+		for (int i = 0; i < index; i++)
+			*slot(list, i) = *slot(list, i + 1);
+	}
+	else {
+		for (int i = list->count; i > index; i--)
+			*slot(list, i) = *slot(list, i - 1);
+	}
+	*slot(list, index) = data;
+	++(list->count);
+	return 0;
+}
+
+int listCount(const List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listCount:list is NULL.\n");
+		return -1;
+	}
+	return list->count;
+}
@@ -0,0 +1,29 @@
+#ifndef _RINGBUFFERDEQUE_H_
+#define _RINGBUFFERDEQUE_H_
+
+typedef struct List List;  //For data-hiding.
+typedef void(FreeFunction)(void *ptr);
+
+#ifndef INITIAL_SIZE
+#define INITIAL_SIZE (8)  //user can define the initial size. It must be a power of two.
+#endif
+
+// Same API as DoublyLinkedList.h, kept in one circular buffer of pointers.
+// The elements sit next to each other, so the ends and listGet()/listSet()
+// are O(1) and nothing is allocated per element; the buffer doubles when full.
+// listInsert() and listRemove() shift the shorter side : O(min(index, count - index)).
+List *listInitialize(FreeFunction freeFunction);
+int listFinalize(List *list);
+void listDisplay(const List *list, const char *(*displayFunc)(const void *));
+void listReverseDisplay(const List *list, const char *(*displayFunc)(const void *));
+int listAddBack(List *list, void *data);
+int listAddFront(List *list, void *data);
+void *listRemove(List *list, int index);
+void *listRemoveHead(List *list);
+void *listRemoveTail(List *list);
+void *listGet(const List *list, int index);
+void *listSet(List *list, int index, void *newData);
+int listInsert(List *list, int index, void *data);
+int listCount(const List *list);
+
+#endif
@@ -0,0 +1,60 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "RingBufferDeque.h"
+
+typedef struct {
+	char name[32];
+	int age;
+} Person;
+
+const char *toPerson(const void *data) {
+	static char buf[48];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+int main() {
+	List *list = listInitialize(NULL);
+
+	Person people[5] = { {"A",1},{"B",2},{"C",3},{"D",4},{"E",5} };
+
+	// Adding at both ends wraps around the buffer.
+	for (int i = 0; i < 5; i++) {
+		if (i % 2 == 0)
+			listAddBack(list, people + i);
+		else
+			listAddFront(list, people + i);
+		listDisplay(list, toPerson);
+	}
+
+	Person second = { "SECOND", 22 };
+	listInsert(list, 1, &second);
+	listDisplay(list, toPerson);
+
+	listRemove(list, 3);
+	listDisplay(list, toPerson);
+	listReverseDisplay(list, toPerson);
+
+	printf("head : %s\n", toPerson(listRemoveHead(list)));
+	printf("tail : %s\n", toPerson(listRemoveTail(list)));
+	printf("list[1] : %s\n", toPerson(listGet(list, 1)));
+	listFinalize(list);
+
+	// A queue workload : no allocation once the buffer is big enough.
+	const int count = 10000000;
+	list = listInitialize(NULL);
+	clock_t start = clock();
+	for (int i = 0; i < count; i++) {
+		listAddBack(list, people + i % 5);
+		if (listCount(list) > 1000)
+			listRemoveHead(list);
+	}
+	printf("%d pushes and pops : %.3f sec\n", count,
+		(double)(clock() - start) / CLOCKS_PER_SEC);
+
+	listFinalize(list);
+	return 0;
+}
@@ -0,0 +1,178 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include "SpscRingBuffer.h"
+
+// head and tail count every element ever popped and pushed; the slot is the
+// index masked by capacity - 1, and tail - head is the number of elements.
+typedef struct Ring {
+	void **slots;
+	size_t mask;
+	char padding0[CACHE_LINE];
+	atomic_size_t tail;  // written by the producer only.
+	size_t cachedHead;  // the producer's copy of head.
+	char padding1[CACHE_LINE];
+	atomic_size_t head;  // written by the consumer only.
+	size_t cachedTail;  // the consumer's copy of tail.
+	char padding2[CACHE_LINE];
+}Ring;
+
+// Free slots the producer may fill, reloading head only if the copy says too few.
+static size_t freeSlots(Ring *ring, size_t tail, size_t wanted) {
+	size_t capacity = ring->mask + 1;
+	size_t available = capacity - (tail - ring->cachedHead);
+	if (available < wanted) {
+		ring->cachedHead = atomic_load_explicit(&ring->head, memory_order_acquire);
+		available = capacity - (tail - ring->cachedHead);
+	}
+	return available;
+}
+
+// Filled slots the consumer may take, reloading tail only if the copy says too few.
+static size_t filledSlots(Ring *ring, size_t head, size_t wanted) {
+	size_t available = ring->cachedTail - head;
+	if (available < wanted) {
+		ring->cachedTail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+		available = ring->cachedTail - head;
+	}
+	return available;
+}
+
+Ring *ringCreate(int capacity) {
+	if (capacity <= 0 || capacity > INT_MAX / 2 + 1) {
+		fprintf(stderr, "ringCreate : capacity is out of bound.\n");
+		return NULL;
+	}
+
+	size_t size = 1;
+	while (size < (size_t)capacity)
+		size <<= 1;
+
+	Ring *ring = calloc(1, sizeof(Ring));
+	if (ring == NULL) {
+		fprintf(stderr, "ringCreate : calloc failed.\n");
+		return NULL;
+	}
+
+	ring->slots = malloc(sizeof(void *) * size);
+	if (ring->slots == NULL) {
+		fprintf(stderr, "ringCreate : malloc failed.\n");
+		free(ring);
+		return NULL;
+	}
+
+	ring->mask = size - 1;
+	atomic_init(&ring->head, 0);
+	atomic_init(&ring->tail, 0);
+	return ring;
+}
+
+void ringDestroy(Ring *ring) {
+	if (ring == NULL)
+		return;
+	free(ring->slots);
+	free(ring);
+}
+
+int ringPush(Ring *ring, void *data) {
+	if (ring == NULL || data == NULL) {
+		fprintf(stderr, "ringPush : argument is NULL.\n");
+		return -1;
+	}
+
+	size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	if (freeSlots(ring, tail, 1) == 0)
+		return -1;
+
+	ring->slots[tail & ring->mask] = data;
+	atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+	return 0;
+}
+
+void *ringPop(Ring *ring) {
+	if (ring == NULL) {
+		fprintf(stderr, "ringPop : argument is NULL.\n");
+		return NULL;
+	}
+
+	size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	if (filledSlots(ring, head, 1) == 0)
+		return NULL;
+
+	void *data = ring->slots[head & ring->mask];
+	atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+	return data;
+}
+
+int ringPushBatch(Ring *ring, void *const *items, int count) {
+	if (ring == NULL || items == NULL) {
+		fprintf(stderr, "ringPushBatch : argument is NULL.\n");
+		return -1;
+	}
+
+	if (count <= 0)
+		return 0;
+
+	size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	size_t n = freeSlots(ring, tail, (size_t)count);
+	if (n > (size_t)count)
+		n = (size_t)count;
+
+	// At most two copies : up to the end of the array, then from its start.
+	size_t start = tail & ring->mask;
+	size_t first = ring->mask + 1 - start;
+	if (first > n)
+		first = n;
+	memcpy(ring->slots + start, items, sizeof(void *) * first);
+	memcpy(ring->slots, items + first, sizeof(void *) * (n - first));
+
+	atomic_store_explicit(&ring->tail, tail + n, memory_order_release);
+	return (int)n;
+}
+
+int ringPopBatch(Ring *ring, void **outItems, int count) {
+	if (ring == NULL || outItems == NULL) {
+		fprintf(stderr, "ringPopBatch : argument is NULL.\n");
+		return -1;
+	}
+
+	if (count <= 0)
+		return 0;
+
+	size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	size_t n = filledSlots(ring, head, (size_t)count);
+	if (n > (size_t)count)
+		n = (size_t)count;
+
+	size_t start = head & ring->mask;
+	size_t first = ring->mask + 1 - start;
+	if (first > n)
+		first = n;
+	memcpy(outItems, ring->slots + start, sizeof(void *) * first);
+	memcpy(outItems + first, ring->slots, sizeof(void *) * (n - first));
+
+	atomic_store_explicit(&ring->head, head + n, memory_order_release);
+	return (int)n;
+}
+
+int ringCount(const Ring *ring) {
+	if (ring == NULL) {
+		fprintf(stderr, "ringCount : argument is NULL.\n");
+		return -1;
+	}
+
+	size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+	size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+	size_t count = tail - head;
+	return (count <= ring->mask + 1) ? (int)count : 0;
+}
+
+int ringCapacity(const Ring *ring) {
+	if (ring == NULL) {
+		fprintf(stderr, "ringCapacity : argument is NULL.\n");
+		return -1;
+	}
+	return (int)(ring->mask + 1);
+}
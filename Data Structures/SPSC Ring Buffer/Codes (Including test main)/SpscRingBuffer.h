@@ -0,0 +1,32 @@
+#ifndef _SPSCRINGBUFFER_H_
+#define _SPSCRINGBUFFER_H_
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef CACHE_LINE
+#define CACHE_LINE (64)  //user can define the cache line size of the target.
+#endif
+
+typedef struct Ring Ring;  //For data-hiding.
+
+// Bounded queue for exactly one producer thread and one consumer thread.
+// No lock and no allocation after ringCreate() : the producer only writes tail
+// and the consumer only writes head, each on its own cache line, published with
+// release stores and read with acquire loads. Each side also keeps a copy of
+// the other's index and reloads it only when the ring looks full or empty.
+//
+// capacity is rounded up to a power of two. ringPush() returns -1 when the ring
+// is full, and ringPop() returns NULL when it is empty, so data can't be NULL.
+// The batch functions move up to count elements with one index update and
+// return how many they moved. ringCount() is exact only between the two threads'
+// operations.
+Ring *ringCreate(int capacity);
+void ringDestroy(Ring *ring);
+int ringPush(Ring *ring, void *data);
+void *ringPop(Ring *ring);
+int ringPushBatch(Ring *ring, void *const *items, int count);
+int ringPopBatch(Ring *ring, void **outItems, int count);
+int ringCount(const Ring *ring);
+int ringCapacity(const Ring *ring);
+
+#endif
@@ -0,0 +1,215 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <threads.h>
+#include "SpscRingBuffer.h"
+
+typedef struct Person {
+	char name[32];
+	int age;
+}Person;
+
+const char *toPerson(const void *data) {
+	static char buf[48];
+	const Person *person = (const Person *)data;
+	snprintf(buf, sizeof(buf), "%.31s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+// Throughput test : one thread produces, one consumes.
+#define MESSAGES (10000000)
+#define BATCH (64)
+
+static Ring *shared;
+static int batched;
+static long long checksum;
+
+int producer(void *arg) {
+	(void)arg;
+	void *items[BATCH];
+	for (long long i = 1; i <= MESSAGES; ) {
+		if (batched) {
+			int n = 0;
+			while (n < BATCH && i + n <= MESSAGES) {
+				items[n] = (void *)(size_t)(i + n);
+				n++;
+			}
+			int pushed = 0;
+			while (pushed < n) {
+				int moved = ringPushBatch(shared, items + pushed, n - pushed);
+				if (moved == 0)
+					thrd_yield();
+				pushed += moved;
+			}
+			i += n;
+		}
+		else {
+			while (ringPush(shared, (void *)(size_t)i) == -1)
+				thrd_yield();
+			i++;
+		}
+	}
+	return 0;
+}
+
+int consumer(void *arg) {
+	(void)arg;
+	void *items[BATCH];
+	long long received = 0;
+	long long sum = 0;
+	while (received < MESSAGES) {
+		if (batched) {
+			int n = ringPopBatch(shared, items, BATCH);
+			if (n == 0)
+				thrd_yield();
+			for (int i = 0; i < n; i++)
+				sum += (long long)(size_t)items[i];
+			received += n;
+		}
+		else {
+			void *item = ringPop(shared);
+			if (item == NULL) {
+				thrd_yield();
+				continue;
+			}
+			sum += (long long)(size_t)item;
+			received++;
+		}
+	}
+	checksum = sum;
+	return 0;
+}
+
+// Stress test : both threads mix single and batch calls of varying sizes,
+// and the consumer checks that every message arrives once and in order.
+#define STRESS_MESSAGES (2000000)
+
+static int outOfOrder;
+
+int stressProducer(void *arg) {
+	(void)arg;
+	void *items[BATCH];
+	unsigned int seed = 1;
+	for (size_t i = 1; i <= STRESS_MESSAGES; ) {
+		seed = seed * 1103515245u + 12345u;
+		int n = (int)((seed >> 16) % BATCH) + 1;
+		if (i + n > STRESS_MESSAGES + 1)
+			n = (int)(STRESS_MESSAGES + 1 - i);
+
+		if (n == 1) {
+			while (ringPush(shared, (void *)i) == -1)
+				thrd_yield();
+		}
+		else {
+			for (int j = 0; j < n; j++)
+				items[j] = (void *)(i + j);
+			int pushed = 0;
+			while (pushed < n) {
+				int moved = ringPushBatch(shared, items + pushed, n - pushed);
+				if (moved == 0)
+					thrd_yield();
+				pushed += moved;
+			}
+		}
+		i += n;
+	}
+	return 0;
+}
+
+int stressConsumer(void *arg) {
+	(void)arg;
+	void *items[BATCH];
+	unsigned int seed = 2;
+	size_t expected = 1;
+	while (expected <= STRESS_MESSAGES) {
+		seed = seed * 1103515245u + 12345u;
+		int n = (int)((seed >> 16) % BATCH) + 1;
+		if (n == 1) {
+			void *item = ringPop(shared);
+			if (item == NULL) {
+				thrd_yield();
+				continue;
+			}
+			items[0] = item;
+		}
+		else {
+			n = ringPopBatch(shared, items, n);
+			if (n == 0)
+				thrd_yield();
+		}
+
+		for (int j = 0; j < n; j++) {
+			if ((size_t)items[j] != expected)
+				outOfOrder++;
+			expected++;
+		}
+	}
+	return 0;
+}
+
+static double now(void) {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main() {
+	Ring *ring = ringCreate(5);
+	printf("capacity : %d\n\n", ringCapacity(ring));
+
+	Person people[10] = {
+		{"A", 11}, {"B", 22}, {"C", 33}, {"D", 44}, {"E", 55},
+		{"F", 66}, {"G", 77}, {"H", 88}, {"I", 99}, {"J", 100} };
+
+	printf("========ringPush() test========\n\n");
+	for (int i = 0; i < 10; i++) {
+		if (ringPush(ring, people + i) == -1)
+			printf("%s doesn't fit\n", toPerson(people + i));
+	}
+	printf("count : %d\n\n", ringCount(ring));
+
+	printf("========ringPopBatch() test========\n\n");
+	void *items[3];
+	int n;
+	while ((n = ringPopBatch(ring, items, 3)) > 0) {
+		for (int i = 0; i < n; i++)
+			printf("%s ", toPerson(items[i]));
+		printf("\n");
+	}
+	printf("count : %d\n\n", ringCount(ring));
+	ringDestroy(ring);
+
+	printf("========throughput test========\n\n");
+	for (batched = 0; batched <= 1; batched++) {
+		shared = ringCreate(4096);
+		thrd_t threads[2];
+		double start = now();
+		thrd_create(&threads[0], producer, NULL);
+		thrd_create(&threads[1], consumer, NULL);
+		thrd_join(threads[0], NULL);
+		thrd_join(threads[1], NULL);
+		double elapsed = now() - start;
+
+		long long expected = (long long)MESSAGES * (MESSAGES + 1) / 2;
+		printf("%s : %.2f M messages/s%s\n", batched ? "batch" : "single",
+			MESSAGES / elapsed / 1e6, (checksum == expected) ? "" : " (lost messages!)");
+		ringDestroy(shared);
+	}
+
+	printf("\n========stress test========\n\n");
+	int capacities[4] = { 1, 4, 16, 64 };
+	for (int i = 0; i < 4; i++) {
+		shared = ringCreate(capacities[i]);
+		outOfOrder = 0;
+		thrd_t threads[2];
+		thrd_create(&threads[0], stressProducer, NULL);
+		thrd_create(&threads[1], stressConsumer, NULL);
+		thrd_join(threads[0], NULL);
+		thrd_join(threads[1], NULL);
+		printf("capacity %2d : %d messages, %d out of order, %d left\n", capacities[i],
+			STRESS_MESSAGES, outOfOrder, ringCount(shared));
+		ringDestroy(shared);
+	}
+	return 0;
+}
@@ -13,6 +13,7 @@ typedef struct Node {
 typedef struct List {
 	Node *head;
 	Node *tail;
+	Node *last;  // last element, or head when the list is empty.
 	int count;
 	FreeFunction *freeFunction;
 }List;
@@ -51,6 +52,8 @@ void *listRemove(List *list, int index) {
 	Node *delNode = prev->next;
 	void *outData = delNode->data;
 	prev->next = delNode->next;
+	if (list->last == delNode)
+		list->last = prev;
 	free(delNode);
 	--(list->count);
 	return outData;
@@ -168,6 +171,7 @@ List *listInitialize(FreeFunction freeFunction) {
 	list->tail = tail;
 	head->next = tail;
 	tail->next = tail;
+	list->last = head;
 	list->count = 0;
 	list->freeFunction = freeFunction;
 	return list;
@@ -210,11 +214,8 @@ int listAdd(List *list, void *data) {
 	}
 	node->data = data;
 	node->next = list->tail;
-
-	Node *cur = list->head;
-	while (cur->next != list->tail)
-		cur = cur->next;
-	cur->next = node;
+	list->last->next = node;
+	list->last = node;
 	++(list->count);
 	return 0;
 }
@@ -232,3 +233,168 @@ void listDisplay(const List *list, const char *(*displayFunc)(const void *)) {
 	printf("->[tail]");
 	getchar();
 }
+
+int listBegin(List *list, ListCursor *cursor) {
+	if (list == NULL || cursor == NULL) {
+		fprintf(stderr, "listBegin:argument is NULL.\n");
+		return -1;
+	}
+
+	cursor->list = list;
+	cursor->prev = NULL;
+	cursor->node = list->head;
+	return 0;
+}
+
+int listNext(ListCursor *cursor, void **outData) {
+	if (cursor == NULL || outData == NULL) {
+		fprintf(stderr, "listNext:argument is NULL.\n");
+		return -1;
+	}
+
+	Node *next = cursor->node->next;
+	if (next == cursor->list->tail)
+		return 0;
+
+	cursor->prev = cursor->node;
+	cursor->node = next;
+	*outData = next->data;
+	return 1;
+}
+
+int listInsertAfter(ListCursor *cursor, void *data) {
+	if (cursor == NULL) {
+		fprintf(stderr, "listInsertAfter:cursor is NULL.\n");
+		return -1;
+	}
+
+	Node *node = malloc(sizeof(Node));
+	if (node == NULL) {
+		perror("listInsertAfter");
+		return -1;
+	}
+	node->data = data;
+
+	List *list = cursor->list;
+	node->next = cursor->node->next;
+	cursor->node->next = node;
+	if (list->last == cursor->node)
+		list->last = node;
+	++(list->count);
+	return 0;
+}
+
+void *listRemoveAt(ListCursor *cursor) {
+	if (cursor == NULL) {
+		fprintf(stderr, "listRemoveAt:cursor is NULL.\n");
+		return NULL;
+	}
+
+	if (cursor->prev == NULL) {
+		fprintf(stderr, "listRemoveAt:cursor is not on an element.\n");
+		return NULL;
+	}
+
+	List *list = cursor->list;
+	Node *delNode = cursor->node;
+	void *outData = delNode->data;
+	cursor->prev->next = delNode->next;
+	if (list->last == delNode)
+		list->last = cursor->prev;
+	free(delNode);
+	--(list->count);
+
+	// The previous node becomes current. Its own previous node is unknown,
+	// so the cursor has to move before removing again.
+	cursor->node = cursor->prev;
+	cursor->prev = NULL;
+	return outData;
+}
+
+// Stable merge of two NULL-terminated chains, linked after tail.
+// Returns the last node of the result.
+static Node *mergeChains(Node *left, Node *right, Node *tail, CompareFunction compare) {
+	while (left != NULL && right != NULL) {
+		if (compare(right->data, left->data) < 0) {
+			tail->next = right;
+			right = right->next;
+		}
+		else {
+			tail->next = left;
+			left = left->next;
+		}
+		tail = tail->next;
+	}
+	tail->next = (left != NULL) ? left : right;
+	while (tail->next != NULL)
+		tail = tail->next;
+	return tail;
+}
+
+// Cuts the chain after n nodes and returns the rest.
+static Node *splitChain(Node *node, int n) {
+	for (int i = 1; node != NULL && i < n; i++)
+		node = node->next;
+	if (node == NULL)
+		return NULL;
+	Node *rest = node->next;
+	node->next = NULL;
+	return rest;
+}
+
+// Merges runs of width 1, 2, 4, ... until one run is left.
+static Node *sortChain(Node *head, int count, CompareFunction compare) {
+	Node *tail = head;
+	for (int width = 1; width < count; width *= 2) {
+		tail = head;
+		Node *cur = head->next;
+		while (cur != NULL) {
+			Node *left = cur;
+			Node *right = splitChain(left, width);
+			cur = splitChain(right, width);
+			tail = mergeChains(left, right, tail, compare);
+		}
+	}
+	return tail;
+}
+
+int listSort(List *list, CompareFunction compare) {
+	if (list == NULL || compare == NULL) {
+		fprintf(stderr, "listSort:argument is NULL.\n");
+		return -1;
+	}
+
+	if (list->count < 2)
+		return 0;
+
+	list->last->next = NULL;
+	list->last = sortChain(list->head, list->count, compare);
+	list->last->next = list->tail;
+	return 0;
+}
+
+int listMerge(List *list, List *other, CompareFunction compare) {
+	if (list == NULL || other == NULL || compare == NULL) {
+		fprintf(stderr, "listMerge:argument is NULL.\n");
+		return -1;
+	}
+
+	if (list == other) {
+		fprintf(stderr, "listMerge:lists are the same.\n");
+		return -1;
+	}
+
+	if (other->count == 0)
+		return 0;
+
+	list->last->next = NULL;
+	other->last->next = NULL;
+	list->last = mergeChains(list->head->next, other->head->next, list->head, compare);
+	list->last->next = list->tail;
+	list->count += other->count;
+
+	other->head->next = other->tail;
+	other->last = other->head;
+	other->count = 0;
+	return 0;
+}
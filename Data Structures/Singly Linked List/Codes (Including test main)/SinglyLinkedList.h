@@ -16,4 +16,30 @@ int listFinalize(List *list);
 int listAdd(List *list, void *data);
 void listDisplay(const List *list, const char *(*displayFunc)(const void *));
 
+// A cursor walks the list once, so a full scan is O(n) instead of O(n^2) with listGet().
+// listBegin() puts the cursor before the first element.
+// listNext() moves to the next element and returns 1, or returns 0 at the end.
+// listInsertAfter() adds after the current element, or at the front before the first listNext().
+// listRemoveAt() removes the current element; the next listNext() goes to the one after it.
+// Changing the list any other way invalidates the cursor.
+typedef struct ListCursor {
+	List *list;
+	Node *prev;
+	Node *node;
+}ListCursor;
+
+int listBegin(List *list, ListCursor *cursor);
+int listNext(ListCursor *cursor, void **outData);
+int listInsertAfter(ListCursor *cursor, void *data);
+void *listRemoveAt(ListCursor *cursor);
+
+// compare receives the data of two elements. listSort() is a stable bottom-up
+// merge sort that relinks the nodes, so it allocates nothing and uses no recursion.
+// listMerge() moves every element of the sorted list other into the sorted list
+// list, keeping both orders; other is left empty.
+typedef int (*CompareFunction)(const void *data1, const void *data2);
+
+int listSort(List *list, CompareFunction compare);
+int listMerge(List *list, List *other, CompareFunction compare);
+
 #endif
\ No newline at end of file
@@ -14,6 +14,12 @@ const char *toPerson(const void *data) {
 	return (const char *)buf;
 }
 
+int comparePerson(const void *data1, const void *data2) {
+	const Person *p1 = data1;
+	const Person *p2 = data2;
+	return (p1->age - p2->age);
+}
+
 int main() {
 
 	
@@ -33,6 +39,33 @@ int main() {
 	listRemove(list, 2), listDisplay(list, toPerson);
 	listRemove(list, 0), listDisplay(list, toPerson);
 
+	// Cursor : drop everyone older than 30 and put a new person after B, in one pass.
+	Person newcomer = { "F", 25 };
+	ListCursor cursor;
+	void *data;
+	listBegin(list, &cursor);
+	while (listNext(&cursor, &data) == 1) {
+		Person *person = data;
+		if (person->age > 30)
+			listRemoveAt(&cursor);
+		else if (person->name[0] == 'B')
+			listInsertAfter(&cursor, &newcomer);
+	}
+	listDisplay(list, toPerson);
+
+	// Sorting relinks the nodes; merging moves the other list's nodes in.
+	List *others = listInitialize(NULL);
+	Person more[3] = { {"G", 66}, {"H", 5}, {"I", 30} };
+	for (int i = 0; i < 3; i++) {
+		listAdd(others, more + i);
+	}
+	listSort(others, comparePerson);
+	listDisplay(others, toPerson);
+
+	listMerge(list, others, comparePerson);
+	listDisplay(list, toPerson);
+	listFinalize(others);
+
 	listFinalize(list);
 	return 0;
 	
@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "TieredArray.h"
+
+#define MASK (BLOCK_SIZE - 1)
+
+typedef struct Block {
+	int offset;  // position of the first element in the circular buffer.
+	int count;
+	void *elements[BLOCK_SIZE];
+}Block;
+
+typedef struct Array {
+	Block **blocks;
+	int blockCount;
+	int indexSize;
+	int count;
+}Array;
+
+static void **blockAt(Block *block, int index) {
+	return &block->elements[(block->offset + index) & MASK];
+}
+
+static void pushFront(Block *block, void *data) {
+	block->offset = (block->offset - 1) & MASK;
+	block->elements[block->offset] = data;
+	++(block->count);
+}
+
+static void pushBack(Block *block, void *data) {
+	*blockAt(block, block->count) = data;
+	++(block->count);
+}
+
+static void *popFront(Block *block) {
+	void *data = block->elements[block->offset];
+	block->offset = (block->offset + 1) & MASK;
+	--(block->count);
+	return data;
+}
+
+static void *popBack(Block *block) {
+	--(block->count);
+	return *blockAt(block, block->count);
+}
+
+// Shifts whichever side of index is shorter.
+static void blockInsert(Block *block, int index, void *data) {
+	if (index < block->count / 2) {
+		block->offset = (block->offset - 1) & MASK;
+		for (int i = 0; i < index; i++)
+			*blockAt(block, i) = *blockAt(block, i + 1);
+	}
+	else {
+		for (int i = block->count; i > index; i--)
+			*blockAt(block, i) = *blockAt(block, i - 1);
+	}
+	*blockAt(block, index) = data;
+	++(block->count);
+}
+
+static void *blockRemove(Block *block, int index) {
+	void *data = *blockAt(block, index);
+	if (index < block->count / 2) {
+		for (int i = index; i > 0; i--)
+			*blockAt(block, i) = *blockAt(block, i - 1);
+		block->offset = (block->offset + 1) & MASK;
+	}
+	else {
+		for (int i = index; i < block->count - 1; i++)
+			*blockAt(block, i) = *blockAt(block, i + 1);
+	}
+	--(block->count);
+	return data;
+}
+
+// Adds an empty block at the end. Only the index of blocks is reallocated.
+static int addBlock(Array *array) {
+	if (array->blockCount == array->indexSize) {
+		int newSize = (array->indexSize == 0) ? 4 : array->indexSize * 2;
+		Block **newBlocks = realloc(array->blocks, sizeof(Block *) * newSize);
+		if (newBlocks == NULL) {
+			fprintf(stderr, "addBlock : realloc failed.\n");
+			return -1;
+		}
+		array->blocks = newBlocks;
+		array->indexSize = newSize;
+	}
+
+	Block *block = calloc(1, sizeof(Block));
+	if (block == NULL) {
+		perror("addBlock");
+		return -1;
+	}
+	array->blocks[array->blockCount++] = block;
+	return 0;
+}
+
+static int lastBlockIsFull(const Array *array) {
+	return array->blockCount == 0 || array->blocks[array->blockCount - 1]->count == BLOCK_SIZE;
+}
+
+Array *arrayCreate() {
+	Array *array = calloc(1, sizeof(Array));
+	if (array == NULL) {
+		perror("arrayCreate");
+		return NULL;
+	}
+	return array;
+}
+
+void arrayDestroy(Array *array) {
+	if (array == NULL)
+		return;
+	for (int i = 0; i < array->blockCount; i++)
+		free(array->blocks[i]);
+	free(array->blocks);
+	free(array);
+}
+
+int arrayAdd(Array *array, void *data) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayAdd: argument is null\n");
+		return -1;
+	}
+
+	if (lastBlockIsFull(array) && addBlock(array) == -1) {
+		fprintf(stderr, "arrayAdd : memory allocation failed\n");
+		return -1;
+	}
+
+	pushBack(array->blocks[array->blockCount - 1], data);
+	++(array->count);
+	return 0;
+}
+
+void arrayDisplay(const Array *array, const char *(*display)(const void *)) {
+
+	if (array == NULL || display == NULL) {
+		fprintf(stderr, "arrayDisplay : argument is null.\n");
+		return;
+	}
+
+	system("cls");
+	for (int i = 0; i < array->blockCount * BLOCK_SIZE; i++) {
+		if (i % BLOCK_SIZE == 0 && i != 0)
+			printf("|");
+		if (i < array->count)
+			printf("[%s]", display(arrayGet(array, i)));
+		else
+			printf("[%2c]", ' ');
+	}
+	getchar();
+}
+
+void *arraySet(Array *array, int index, void *newData) {
+	if (array == NULL) {
+		fprintf(stderr, "arraySet: argument is null\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= array->count) {
+		fprintf(stderr, "arraySet: out of index\n");
+		return NULL;
+	}
+
+	void **slot = blockAt(array->blocks[index / BLOCK_SIZE], index % BLOCK_SIZE);
+	void *oldData = *slot;
+	*slot = newData;
+	return oldData;
+}
+
+int arrayInsert(Array *array, int index, void *newData) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayInsert: argument is null\n");
+		return -1;
+	}
+
+	if (index < 0 || index >= array->count) {
+		fprintf(stderr, "arrayInsert: out of index\n");
+		return -1;
+	}
+
+	if (lastBlockIsFull(array) && addBlock(array) == -1) {
+		fprintf(stderr, "arrayInsert : memory allocation failed\n");
+		return -1;
+	}
+
+	// The overflowing last element of each full block moves to the front of the next one.
+	int k = index / BLOCK_SIZE;
+	Block *block = array->blocks[k];
+	void *carry = NULL;
+	int carrying = (block->count == BLOCK_SIZE);
+	if (carrying)
+		carry = popBack(block);
+	blockInsert(block, index % BLOCK_SIZE, newData);
+
+	for (k = k + 1; carrying; k++) {
+		block = array->blocks[k];
+		void *next = NULL;
+		carrying = (block->count == BLOCK_SIZE);
+		if (carrying)
+			next = popBack(block);
+		pushFront(block, carry);
+		carry = next;
+	}
+
+	++(array->count);
+	return 0;
+}
+
+int arrayCount(const Array *array) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayCount: argument is null\n");
+		return -1;
+	}
+	return array->count;
+}
+
+void *arrayGet(const Array *array, int index) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayGet: argument is null\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= array->count) {
+		fprintf(stderr, "arrayGet: out of index\n");
+		return NULL;
+	}
+	return *blockAt(array->blocks[index / BLOCK_SIZE], index % BLOCK_SIZE);
+}
+
+void *arrayRemove(Array *array, int index) {
+	if (array == NULL) {
+		fprintf(stderr, "arrayRemove: argument is null\n");
+		return NULL;
+	}
+
+	if (array->count == 0) {
+		fprintf(stderr, "arrayRemove: array is empty\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= array->count) {
+		fprintf(stderr, "arrayRemove: out of index\n");
+		return NULL;
+	}
+
+	// Each following block gives its first element to the block before it.
+	int k = index / BLOCK_SIZE;
+	void *oldData = blockRemove(array->blocks[k], index % BLOCK_SIZE);
+	for (k = k + 1; k < array->blockCount; k++)
+		pushBack(array->blocks[k - 1], popFront(array->blocks[k]));
+
+	Block *last = array->blocks[array->blockCount - 1];
+	if (last->count == 0) {
+		free(last);
+		--(array->blockCount);
+	}
+
+	--(array->count);
+	return oldData;
+}
@@ -0,0 +1,29 @@
+#ifndef _TIEREDARRAY_H_
+#define _TIEREDARRAY_H_
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct Array Array;  //For data-hiding.
+
+#ifndef BLOCK_SIZE
+#define BLOCK_SIZE (64)  //user can define the block size. It must be a power of two.
+#endif
+
+// Same API as Array.h, built from fixed-size circular blocks.
+// Every block except the last one is full, so arrayGet() is O(1),
+// and arrayInsert()/arrayRemove() shift one block and rotate the rest :
+// O(BLOCK_SIZE + count / BLOCK_SIZE), which is O(sqrt(n)) while n <= BLOCK_SIZE^2.
+// Growing adds a block and never moves existing elements.
+Array *arrayCreate();
+void arrayDestroy(Array *array);
+int arrayAdd(Array *array, void *data);
+void arrayDisplay(const Array *array, const char *(*display)(const void *));
+void *arraySet(Array *array, int index, void *newData);
+int arrayInsert(Array *array, int index, void *newData);
+int arrayCount(const Array *array);
+void *arrayGet(const Array *array, int index);
+void *arrayRemove(Array *array, int index);
+
+#endif
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "TimingWheel.h"
+
+#if WHEEL_BITS * WHEEL_LEVELS >= 64
+#error "WHEEL_BITS * WHEEL_LEVELS must be less than 64."
+#endif
+
+#define SLOT_MASK (WHEEL_SLOTS - 1)
+#define MAX_DELTA (((uint64_t)1 << (WHEEL_BITS * WHEEL_LEVELS)) - 1)
+
+typedef struct Wheel {
+	uint64_t now;
+	int count;
+	Node slots[WHEEL_LEVELS][WHEEL_SLOTS];  // every slot is the head of a circular list.
+}Wheel;
+
+// A timer that isn't on any list links to itself.
+static void unlinkTimer(Timer *timer) {
+	listRemove(&timer->node);
+	timer->node.next = &timer->node;
+	timer->node.prev = &timer->node;
+}
+
+// Moves every node of from into the empty list head.
+static void moveList(Node *head, Node *from) {
+	if (from->next == from)
+		return;
+	head->next = from->next;
+	head->prev = from->prev;
+	head->next->prev = head;
+	head->prev->next = head;
+	from->next = from;
+	from->prev = from;
+}
+
+// The lowest level whose span covers the delay. Timers further away than the
+// top level can reach wait in its last slot and are placed again from there.
+static void place(Wheel *wheel, Timer *timer) {
+	uint64_t delta = timer->expires - wheel->now;
+	uint64_t expires = (delta > MAX_DELTA) ? wheel->now + MAX_DELTA : timer->expires;
+
+	int level = 0;
+	while (level < WHEEL_LEVELS - 1 && delta >= (uint64_t)1 << (WHEEL_BITS * (level + 1)))
+		level++;
+
+	int index = (int)((expires >> (WHEEL_BITS * level)) & SLOT_MASK);
+	listAdd(&wheel->slots[level][index], &timer->node);
+}
+
+// Moves the current slot of level one level down and returns its index.
+static int cascade(Wheel *wheel, int level) {
+	int index = (int)((wheel->now >> (WHEEL_BITS * level)) & SLOT_MASK);
+	LIST_HEAD(pending);
+	moveList(&pending, &wheel->slots[level][index]);
+	while (pending.next != &pending) {
+		Node *node = pending.next;
+		listRemove(node);
+		place(wheel, list_entry(node, Timer, node));
+	}
+	return index;
+}
+
+// Moves now forward one tick and runs every timer in its level 0 slot.
+static int tick(Wheel *wheel) {
+	++(wheel->now);
+	if ((wheel->now & SLOT_MASK) == 0) {
+		for (int level = 1; level < WHEEL_LEVELS; level++) {
+			if (cascade(wheel, level) != 0)
+				break;
+		}
+	}
+
+	// The slot is moved out first so that functions can add timers to it again.
+	LIST_HEAD(expired);
+	moveList(&expired, &wheel->slots[0][wheel->now & SLOT_MASK]);
+
+	int fired = 0;
+	while (expired.next != &expired) {
+		Timer *timer = list_entry(expired.next, Timer, node);
+		unlinkTimer(timer);
+		--(wheel->count);
+		++fired;
+		timer->function(timer);
+	}
+	return fired;
+}
+
+Wheel *wheelCreate(void) {
+	Wheel *wheel = malloc(sizeof(Wheel));
+	if (wheel == NULL) {
+		fprintf(stderr, "wheelCreate : malloc failed.\n");
+		return NULL;
+	}
+
+	wheel->now = 0;
+	wheel->count = 0;
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		for (int i = 0; i < WHEEL_SLOTS; i++) {
+			wheel->slots[level][i].next = &wheel->slots[level][i];
+			wheel->slots[level][i].prev = &wheel->slots[level][i];
+		}
+	}
+	return wheel;
+}
+
+// Pending timers are left unlinked, so their owners may still free or reuse them.
+void wheelDestroy(Wheel *wheel) {
+	if (wheel == NULL)
+		return;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		for (int i = 0; i < WHEEL_SLOTS; i++) {
+			Node *head = &wheel->slots[level][i];
+			while (head->next != head)
+				unlinkTimer(list_entry(head->next, Timer, node));
+		}
+	}
+	free(wheel);
+}
+
+void timerInit(Timer *timer, TimerFunction function) {
+	if (timer == NULL) {
+		fprintf(stderr, "timerInit : argument is NULL.\n");
+		return;
+	}
+
+	timer->node.next = &timer->node;
+	timer->node.prev = &timer->node;
+	timer->expires = 0;
+	timer->function = function;
+}
+
+int timerPending(const Timer *timer) {
+	if (timer == NULL) {
+		fprintf(stderr, "timerPending : argument is NULL.\n");
+		return -1;
+	}
+	return timer->node.next != &timer->node;
+}
+
+int wheelAdd(Wheel *wheel, Timer *timer, uint64_t ticks) {
+	if (wheel == NULL || timer == NULL || timer->function == NULL) {
+		fprintf(stderr, "wheelAdd : argument is NULL.\n");
+		return -1;
+	}
+
+	if (timerPending(timer)) {
+		unlinkTimer(timer);
+		--(wheel->count);
+	}
+
+	timer->expires = wheel->now + ((ticks > 0) ? ticks : 1);
+	place(wheel, timer);
+	++(wheel->count);
+	return 0;
+}
+
+int wheelCancel(Wheel *wheel, Timer *timer) {
+	if (wheel == NULL || timer == NULL) {
+		fprintf(stderr, "wheelCancel : argument is NULL.\n");
+		return -1;
+	}
+
+	if (!timerPending(timer))
+		return 0;
+
+	unlinkTimer(timer);
+	--(wheel->count);
+	return 1;
+}
+
+int wheelAdvance(Wheel *wheel, uint64_t ticks) {
+	if (wheel == NULL) {
+		fprintf(stderr, "wheelAdvance : argument is NULL.\n");
+		return -1;
+	}
+
+	int fired = 0;
+	for (uint64_t i = 0; i < ticks; i++) {
+		// Nothing can fire, so the remaining ticks are skipped.
+		if (wheel->count == 0) {
+			wheel->now += ticks - i;
+			break;
+		}
+		fired += tick(wheel);
+	}
+	return fired;
+}
+
+uint64_t wheelNow(const Wheel *wheel) {
+	if (wheel == NULL) {
+		fprintf(stderr, "wheelNow : argument is NULL.\n");
+		return 0;
+	}
+	return wheel->now;
+}
+
+int wheelCount(const Wheel *wheel) {
+	if (wheel == NULL) {
+		fprintf(stderr, "wheelCount : argument is NULL.\n");
+		return -1;
+	}
+	return wheel->count;
+}
@@ -0,0 +1,46 @@
+#ifndef _TIMINGWHEEL_H_
+#define _TIMINGWHEEL_H_
+#include <stdint.h>
+#include "../../Doubly Circular Linked List/Codes (Including test main)/DoublyCircularLinkedList.h"
+
+#ifndef WHEEL_BITS
+#define WHEEL_BITS (8)  //user can define log2 of the slots on each level.
+#endif
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_LEVELS (4)  // timers up to 2^(WHEEL_BITS * WHEEL_LEVELS) ticks away.
+
+typedef struct Wheel Wheel;  //For data-hiding.
+typedef struct Timer Timer;
+typedef void (*TimerFunction)(Timer *timer);
+
+// Put a Timer inside your own struct, as with Node, and use list_entry()
+// in the TimerFunction to get your struct back. The wheel never allocates
+// or frees timers.
+typedef struct Timer {
+	Node node;
+	uint64_t expires;
+	TimerFunction function;
+}Timer;
+
+// Hierarchical timing wheel. Every level is an array of circular lists;
+// level 0 holds timers due in the next WHEEL_SLOTS ticks, one slot a tick,
+// and each higher level covers WHEEL_SLOTS times the span of the one below.
+// wheelAdd() and wheelCancel() are O(1). wheelAdvance() looks at one level 0
+// slot per tick and moves a higher slot down only when the level below wraps,
+// so a timer is moved at most WHEEL_LEVELS - 1 times before it fires.
+//
+// wheelAdd() on a pending timer moves it. A timer fires on the first tick
+// at least ticks after now; its function may add or cancel any timer.
+// wheelCancel() returns 1 if the timer was pending and 0 if not.
+// wheelAdvance() returns how many timers fired.
+Wheel *wheelCreate(void);
+void wheelDestroy(Wheel *wheel);
+void timerInit(Timer *timer, TimerFunction function);
+int timerPending(const Timer *timer);
+int wheelAdd(Wheel *wheel, Timer *timer, uint64_t ticks);
+int wheelCancel(Wheel *wheel, Timer *timer);
+int wheelAdvance(Wheel *wheel, uint64_t ticks);
+uint64_t wheelNow(const Wheel *wheel);
+int wheelCount(const Wheel *wheel);
+
+#endif
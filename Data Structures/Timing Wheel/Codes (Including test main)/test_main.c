@@ -0,0 +1,73 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TimingWheel.h"
+
+typedef struct Connection {
+	char name[32];
+	int closed;
+	Timer timeout;
+} Connection;
+
+static Wheel *wheel;
+
+void closeConnection(Timer *timer) {
+	Connection *conn = list_entry(timer, Connection, timeout);
+	conn->closed = 1;
+	printf("tick %llu : %s timed out\n", (unsigned long long)wheelNow(wheel), conn->name);
+}
+
+void countTimeout(Timer *timer) {
+	Connection *conn = list_entry(timer, Connection, timeout);
+	conn->closed = 1;
+}
+
+int main() {
+	wheel = wheelCreate();
+
+	Connection conns[4];
+	const char *names[4] = { "A", "B", "C", "D" };
+	unsigned long long timeouts[4] = { 30, 300, 70000, 50 };
+	for (int i = 0; i < 4; i++) {
+		strcpy(conns[i].name, names[i]);
+		conns[i].closed = 0;
+		timerInit(&conns[i].timeout, closeConnection);
+		wheelAdd(wheel, &conns[i].timeout, timeouts[i]);
+	}
+
+	// D answers, so its timeout starts over; C is closed by its owner.
+	wheelAdvance(wheel, 40);
+	wheelAdd(wheel, &conns[3].timeout, 50);
+	wheelCancel(wheel, &conns[2].timeout);
+	printf("pending : %d\n", wheelCount(wheel));
+
+	wheelAdvance(wheel, 1000);
+	printf("pending : %d\n\n", wheelCount(wheel));
+	wheelDestroy(wheel);
+
+	// Many timeouts, most cancelled before they fire, as with idle connections.
+	const int count = 1000000;
+	Connection *many = malloc(sizeof(Connection) * count);
+	if (many == NULL)
+		return 1;
+
+	wheel = wheelCreate();
+	srand(1);
+	clock_t start = clock();
+	for (int i = 0; i < count; i++) {
+		many[i].closed = 0;
+		timerInit(&many[i].timeout, countTimeout);
+		wheelAdd(wheel, &many[i].timeout, 1 + rand() % 60000);
+	}
+	for (int i = 0; i < count; i += 4)
+		wheelCancel(wheel, &many[i].timeout);
+	int fired = wheelAdvance(wheel, 60000);
+	printf("%d timers, %d fired : %.3f sec\n", count, fired,
+		(double)(clock() - start) / CLOCKS_PER_SEC);
+
+	wheelDestroy(wheel);
+	free(many);
+	return 0;
+}
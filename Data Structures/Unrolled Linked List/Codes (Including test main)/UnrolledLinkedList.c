@@ -0,0 +1,267 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdlib.h>
+#include <stdio.h>
+#include <memory.h>
+#include "UnrolledLinkedList.h"
+
+#if NODE_CAPACITY < 2
+#error "NODE_CAPACITY must be at least 2."
+#endif
+
+typedef struct Node {
+	struct Node *next;
+	int count;
+	void *elements[NODE_CAPACITY];
+} Node;
+
+typedef struct List {
+	Node *head;
+	Node *tail;  // last node, so listAdd doesn't walk the list.
+	int count;
+	FreeFunction *freeFunction;
+}List;
+
+
+// Finds the node holding index. *offset is the position inside it,
+// and *prev the node before it (NULL for head).
+static Node *locate(const List *list, int index, int *offset, Node **prev) {
+	Node *before = NULL;
+	Node *node = list->head;
+	while (index >= node->count) {
+		index -= node->count;
+		before = node;
+		node = node->next;
+	}
+	*offset = index;
+	if (prev != NULL)
+		*prev = before;
+	return node;
+}
+
+static Node *createNode(void) {
+	Node *node = malloc(sizeof(Node));
+	if (node == NULL)
+		return NULL;
+	node->next = NULL;
+	node->count = 0;
+	return node;
+}
+
+void *listRemove(List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listRemove:list is NULL");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listRemove:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listRemove:index is out of bound.\n");
+		return NULL;
+	}
+
+	int offset;
+	Node *prev;
+	Node *node = locate(list, index, &offset, &prev);
+	void *outData = node->elements[offset];
+	memmove(node->elements + offset, node->elements + offset + 1,
+		sizeof(void *) * (node->count - offset - 1));
+	--(node->count);
+	--(list->count);
+
+	// Below half full, take the next node's elements, or one of them if all don't fit.
+	Node *next = node->next;
+	if (next != NULL && node->count < NODE_CAPACITY / 2) {
+		if (node->count + next->count <= NODE_CAPACITY) {
+			memcpy(node->elements + node->count, next->elements, sizeof(void *) * next->count);
+			node->count += next->count;
+			node->next = next->next;
+			if (list->tail == next)
+				list->tail = node;
+			free(next);
+		}
+		else {
+			node->elements[(node->count)++] = next->elements[0];
+			memmove(next->elements, next->elements + 1, sizeof(void *) * (next->count - 1));
+			--(next->count);
+		}
+	}
+	else if (node->count == 0) {
+		// Only the last node can become empty here.
+		if (prev != NULL)
+			prev->next = NULL;
+		else
+			list->head = NULL;
+		list->tail = prev;
+		free(node);
+	}
+	return outData;
+}
+
+void *listGet(const List *list, int index) {
+	if (list == NULL) {
+		fprintf(stderr, "listGet:list is NULL");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listGet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listGet:index is out of bound.\n");
+		return NULL;
+	}
+
+	int offset;
+	Node *node = locate(list, index, &offset, NULL);
+	return node->elements[offset];
+}
+
+int listInsert(List *list, int index, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listInsert:list is NULL");
+		return -1;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listInsert:list is empty.");
+		return -1;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listInsert:index is out of bound.\n");
+		return -1;
+	}
+
+	int offset;
+	Node *node = locate(list, index, &offset, NULL);
+
+	// A full node gives its upper half to a new node after it.
+	if (node->count == NODE_CAPACITY) {
+		Node *half = createNode();
+		if (half == NULL) {
+			fprintf(stderr, "listInsert:malloc failed.\n");
+			return -1;
+		}
+		half->count = NODE_CAPACITY / 2;
+		node->count = NODE_CAPACITY - half->count;
+		memcpy(half->elements, node->elements + node->count, sizeof(void *) * half->count);
+		half->next = node->next;
+		node->next = half;
+		if (list->tail == node)
+			list->tail = half;
+
+		if (offset >= node->count) {
+			offset -= node->count;
+			node = half;
+		}
+	}
+
+	memmove(node->elements + offset + 1, node->elements + offset,
+		sizeof(void *) * (node->count - offset));
+	node->elements[offset] = data;
+	++(node->count);
+	++(list->count);
+	return 0;
+}
+
+void *listSet(List *list, int index, void *newData) {
+	if (list == NULL) {
+		fprintf(stderr, "listSet:list is NULL");
+		return NULL;
+	}
+
+	if (list->count == 0) {
+		fprintf(stderr, "listSet:list is empty.\n");
+		return NULL;
+	}
+
+	if (index < 0 || index >= list->count) {
+		fprintf(stderr, "listSet:index is out of bound.\n");
+		return NULL;
+	}
+
+	int offset;
+	Node *node = locate(list, index, &offset, NULL);
+	void *oldData = node->elements[offset];
+	node->elements[offset] = newData;
+	return oldData;
+}
+
+List *listInitialize(FreeFunction freeFunction) {
+
+	List *list = calloc(1, sizeof(List));
+
+	if (list == NULL) {
+		fprintf(stderr, "listInitialize:calloc failed.\n");
+		return NULL;
+	}
+
+	list->freeFunction = freeFunction;
+	return list;
+}
+
+int listFinalize(List *list) {
+	if (list == NULL) {
+		fprintf(stderr, "listFinalize:list is NULL\n");
+		return -1;
+	}
+
+	while (list->head != NULL) {
+		Node *target = list->head;
+		list->head = target->next;
+		if (list->freeFunction) {
+			for (int i = 0; i < target->count; i++)
+				list->freeFunction(target->elements[i]);
+		}
+		free(target);
+	}
+	free(list);
+	return 0;
+}
+
+int listAdd(List *list, void *data) {
+	if (list == NULL) {
+		fprintf(stderr, "listAdd:list is NULL");
+		return -1;
+	}
+
+	if (list->tail == NULL || list->tail->count == NODE_CAPACITY) {
+		Node *node = createNode();
+		if (node == NULL) {
+			perror("listAdd");
+			return -1;
+		}
+		if (list->tail != NULL)
+			list->tail->next = node;
+		else
+			list->head = node;
+		list->tail = node;
+	}
+
+	list->tail->elements[(list->tail->count)++] = data;
+	++(list->count);
+	return 0;
+}
+
+void listDisplay(const List *list, const char *(*displayFunc)(const void *)) {
+	if (list == NULL) {
+		fprintf(stderr, "listDisplay:list is NULL.\n");
+		return;
+	}
+
+	system("cls");
+	printf("[head]");
+	for (Node *node = list->head; node != NULL; node = node->next) {
+		printf("->");
+		for (int i = 0; i < node->count; i++)
+			printf("[%s]", displayFunc(node->elements[i]));
+	}
+	printf("->[tail]");
+	getchar();
+}
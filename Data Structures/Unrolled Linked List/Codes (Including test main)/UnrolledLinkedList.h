@@ -0,0 +1,27 @@
+#ifndef _UNROLLEDLINKEDLIST_H_
+#define _UNROLLEDLINKEDLIST_H_
+#include <stdio.h>
+#include <stdlib.h>
+
+// Same interface as SinglyLinkedList.h, but each node holds up to
+// NODE_CAPACITY elements. With 14 pointers a node fills two 64-byte cache
+// lines on a 64-bit machine. Every node but the last is at least half full,
+// so NODE_CAPACITY must be at least 2.
+#ifndef NODE_CAPACITY
+#define NODE_CAPACITY (14)  //user can define the number of elements per node.
+#endif
+
+typedef struct Node Node;
+typedef struct List List;
+typedef void(FreeFunction)(void *ptr);
+
+void *listRemove(List *list, int index);
+void *listGet(const List *list, int index);
+int listInsert(List *list, int index, void *data);
+void *listSet(List *list, int index, void *newData);
+List *listInitialize(FreeFunction freeFunction);
+int listFinalize(List *list);
+int listAdd(List *list, void *data);
+void listDisplay(const List *list, const char *(*displayFunc)(const void *));
+
+#endif
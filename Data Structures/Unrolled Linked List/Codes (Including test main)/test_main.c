@@ -0,0 +1,46 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include "UnrolledLinkedList.h"
+
+typedef struct {
+	char name[32];
+	int age;
+}Person;
+
+const char *toPerson(const void *data) {
+	static char buf[48];
+	const Person *person = (const Person *)data;
+	sprintf(buf, "%s(%d)", person->name, person->age);
+	return (const char *)buf;
+}
+
+int main() {
+
+	List *list = listInitialize(NULL);
+
+	Person people[20];
+	for (int i = 0; i < 20; i++) {
+		sprintf(people[i].name, "%c", 'A' + i);
+		people[i].age = 11 * (i + 1);
+	}
+
+	listDisplay(list, toPerson);
+
+	// The elements fill one node before the next is allocated.
+	for (int i = 0; i < NODE_CAPACITY; i++) {
+		listAdd(list, people + i);
+	}
+	listDisplay(list, toPerson);
+
+	// Inserting into a full node splits it in half.
+	listInsert(list, 1, people + 19);
+	listDisplay(list, toPerson);
+
+	// A node below half full takes elements from the next one.
+	for (int i = 0; i < 4; i++) {
+		listRemove(list, 0), listDisplay(list, toPerson);
+	}
+
+	listFinalize(list);
+	return 0;
+}